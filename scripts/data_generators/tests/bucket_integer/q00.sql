@@ -0,0 +1,10 @@
+CREATE OR REPLACE TABLE default.bucket_integer (
+    user_id INT,
+    event_type STRING
+)
+USING iceberg
+PARTITIONED BY (bucket(4, user_id))
+TBLPROPERTIES (
+    'format-version' = '2',
+    'write.update.mode' = 'merge-on-read'
+);
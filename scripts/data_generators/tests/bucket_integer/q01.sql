@@ -0,0 +1,9 @@
+INSERT INTO default.bucket_integer VALUES
+    (1, 'click'),
+    (2, 'purchase'),
+    (3, 'view'),
+    (4, 'click'),
+    (5, 'purchase'),
+    (6, 'view'),
+    (7, 'click'),
+    (8, 'purchase');
@@ -0,0 +1,10 @@
+CREATE OR REPLACE TABLE default.day_timestamp (
+    partition_col TIMESTAMP_NTZ,
+    user_id BIGINT
+)
+USING iceberg
+PARTITIONED BY (days(partition_col))
+TBLPROPERTIES (
+    'format-version' = '2',
+    'write.update.mode' = 'merge-on-read'
+);
@@ -0,0 +1,3 @@
+INSERT INTO default.day_timestamp VALUES
+    (TIMESTAMP_NTZ '2024-01-01 10:00:00', 1),
+    (TIMESTAMP_NTZ '2024-01-01 23:59:59', 2);
@@ -0,0 +1,3 @@
+INSERT INTO default.day_timestamp VALUES
+    (TIMESTAMP_NTZ '2024-01-02 00:00:00', 3),
+    (TIMESTAMP_NTZ '2024-01-02 12:00:00', 4);
@@ -0,0 +1,2 @@
+INSERT INTO default.day_timestamp VALUES
+    (TIMESTAMP_NTZ '2024-01-03 08:00:00', 5);
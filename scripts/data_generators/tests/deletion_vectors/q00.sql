@@ -0,0 +1,9 @@
+CREATE or REPLACE TABLE default.deletion_vectors (
+	id bigint,
+	value string
+)
+TBLPROPERTIES (
+    'format-version'='3',
+    'write.delete.mode'='merge-on-read',
+    'write.update.mode'='merge-on-read'
+);
\ No newline at end of file
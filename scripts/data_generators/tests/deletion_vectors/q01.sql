@@ -0,0 +1,2 @@
+INSERT INTO default.deletion_vectors
+SELECT id, CAST(id AS STRING) AS value FROM range(0, 10000);
\ No newline at end of file
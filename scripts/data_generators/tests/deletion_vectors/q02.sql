@@ -0,0 +1,2 @@
+DELETE FROM default.deletion_vectors
+WHERE id % 10 = 0;
\ No newline at end of file
@@ -0,0 +1,2 @@
+INSERT INTO default.deletion_vectors
+SELECT id, CAST(id AS STRING) AS value FROM range(10000, 11000);
\ No newline at end of file
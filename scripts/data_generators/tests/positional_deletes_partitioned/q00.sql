@@ -0,0 +1,10 @@
+CREATE or REPLACE TABLE default.positional_deletes_partitioned (
+	part integer,
+	id bigint
+)
+PARTITIONED BY (part)
+TBLPROPERTIES (
+    'format-version'='2',
+    'write.delete.mode'='merge-on-read',
+    'write.delete.granularity'='partition'
+);
\ No newline at end of file
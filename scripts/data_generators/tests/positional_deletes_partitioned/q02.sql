@@ -0,0 +1,2 @@
+INSERT INTO default.positional_deletes_partitioned
+SELECT CAST(id % 4 AS INT) AS part, id FROM range(1000, 2000);
\ No newline at end of file
@@ -0,0 +1,2 @@
+DELETE FROM default.positional_deletes_partitioned
+WHERE id % 7 = 0;
\ No newline at end of file
@@ -0,0 +1,10 @@
+CREATE OR REPLACE TABLE default.truncate_string (
+    name STRING,
+    amount INT
+)
+USING iceberg
+PARTITIONED BY (truncate(3, name))
+TBLPROPERTIES (
+    'format-version' = '2',
+    'write.update.mode' = 'merge-on-read'
+);
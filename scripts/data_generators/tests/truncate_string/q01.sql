@@ -0,0 +1,3 @@
+INSERT INTO default.truncate_string VALUES
+    ('apple', 1),
+    ('apricot', 2);
@@ -0,0 +1,3 @@
+INSERT INTO default.truncate_string VALUES
+    ('banana', 3),
+    ('blueberry', 4);
@@ -0,0 +1,2 @@
+INSERT INTO default.truncate_string VALUES
+    ('cherry', 5);
@@ -1,4 +1,7 @@
 #include "manifest_reader.hpp"
+#include "duckdb/common/map.hpp"
+
+#include <algorithm>
 
 namespace duckdb {
 
@@ -8,9 +11,6 @@ void BaseManifestReader::Initialize(unique_ptr<AvroScan> scan_p) {
 	if (!first_init) {
 		chunk.Destroy();
 	}
-	//! Reinitialize for every new scan, the schema isn't guaranteed to be the same for every scan
-	//! the 'partition' of the 'data_file' is based on the partition spec referenced by the manifest
-	scan->InitializeChunk(chunk);
 
 	finished = false;
 	offset = 0;
@@ -25,6 +25,48 @@ void BaseManifestReader::Initialize(unique_ptr<AvroScan> scan_p) {
 	if (!ValidateNameMapping()) {
 		throw InvalidInputException("Invalid schema detected in a manifest/manifest entry");
 	}
+
+	//! Only scan the columns (and fields of the 'data_file') that are used by the reader
+	map<idx_t, vector<ColumnIndex>> projected_columns;
+	for (auto it = name_to_vec.begin(); it != name_to_vec.end();) {
+		if (!ProjectColumn(it->first)) {
+			it = name_to_vec.erase(it);
+			continue;
+		}
+		auto &column_index = it->second;
+		auto &children = projected_columns[column_index.GetPrimaryIndex()];
+		if (column_index.HasChildren()) {
+			children.push_back(column_index.GetChildIndex(0));
+		}
+		it++;
+	}
+	vector<ColumnIndex> column_indexes;
+	for (auto &entry : projected_columns) {
+		auto &children = entry.second;
+		std::sort(children.begin(), children.end(),
+		          [](const ColumnIndex &a, const ColumnIndex &b) { return a.GetPrimaryIndex() < b.GetPrimaryIndex(); });
+		column_indexes.emplace_back(entry.first, std::move(children));
+	}
+	scan->InitializeScan(std::move(column_indexes));
+
+	//! The columns of the chunk are the scanned columns, remap the mapping to the position in the chunk
+	unordered_map<idx_t, idx_t> column_to_chunk_idx;
+	for (idx_t i = 0; i < scan->column_indexes.size(); i++) {
+		column_to_chunk_idx[scan->column_indexes[i].GetPrimaryIndex()] = i;
+	}
+	for (auto &entry : name_to_vec) {
+		auto &column_index = entry.second;
+		auto chunk_idx = column_to_chunk_idx.at(column_index.GetPrimaryIndex());
+		if (column_index.HasChildren()) {
+			column_index = ColumnIndex(chunk_idx, column_index.GetChildIndexes());
+		} else {
+			column_index = ColumnIndex(chunk_idx);
+		}
+	}
+
+	//! Reinitialize for every new scan, the schema isn't guaranteed to be the same for every scan
+	//! the 'partition' of the 'data_file' is based on the partition spec referenced by the manifest
+	scan->InitializeChunk(chunk);
 }
 
 idx_t BaseManifestReader::ScanInternal(idx_t remaining) {
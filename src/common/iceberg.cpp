@@ -19,27 +19,24 @@ IcebergTable IcebergTable::Load(const string &iceberg_path, const IcebergTableMe
 
 	vector<IcebergManifest> manifests;
 
-	//! Set up the manifest + manifest entry readers
-	auto manifest_list = make_uniq<ManifestListReader>(metadata.iceberg_version);
+	//! Set up the manifest entry reader, the manifest entries of every status are produced so they're not cached
 	auto manifest_file_reader = make_uniq<ManifestFileReader>(metadata.iceberg_version, false);
+	//! None of the metrics are part of the metadata that is produced
+	manifest_file_reader->SetReadMetrics(false);
 
 	auto &fs = FileSystem::GetFileSystem(context);
 	auto manifest_list_full_path = options.allow_moved_paths
 	                                   ? IcebergUtils::GetFullPath(iceberg_path, snapshot.manifest_list, fs)
 	                                   : snapshot.manifest_list;
-	auto scan = make_uniq<AvroScan>("IcebergManifestList", context, manifest_list_full_path);
-	manifest_list->Initialize(std::move(scan));
-
-	vector<IcebergManifest> all_manifests;
-	while (!manifest_list->Finished()) {
-		manifest_list->Read(STANDARD_VECTOR_SIZE, all_manifests);
-	}
+	auto all_manifests =
+	    IcebergManifestCache::ReadManifestList(context, manifest_list_full_path, metadata.iceberg_version);
 
 	for (auto &manifest : all_manifests) {
 		auto manifest_entry_full_path = options.allow_moved_paths
 		                                    ? IcebergUtils::GetFullPath(iceberg_path, manifest.manifest_path, fs)
 		                                    : manifest.manifest_path;
-		auto scan = make_uniq<AvroScan>("IcebergManifest", context, manifest_entry_full_path);
+		auto scan =
+		    make_uniq<AvroScan>("IcebergManifest", context, manifest_entry_full_path, manifest.manifest_length);
 		manifest_file_reader->Initialize(std::move(scan));
 		manifest_file_reader->SetSequenceNumber(manifest.sequence_number);
 		manifest_file_reader->SetPartitionSpecID(manifest.partition_spec_id);
@@ -0,0 +1,331 @@
+#include "iceberg_deletion_bitmap.hpp"
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/validity_mask.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace duckdb {
+
+void IcebergDeletionBitmap::Container::ConvertToBitmap() {
+	bitmap.resize(BITMAP_WORDS, 0);
+	for (auto low_bits : array) {
+		bitmap[low_bits / 64] |= uint64_t(1) << (low_bits % 64);
+	}
+	array.clear();
+	array.shrink_to_fit();
+	sorted = true;
+}
+
+IcebergDeletionBitmap::Container &IcebergDeletionBitmap::GetOrCreateContainer(uint64_t high_bits) {
+	//! Positional deletes are sorted by position, the last container is the most likely one
+	if (!containers.empty() && containers.back().high_bits == high_bits) {
+		return containers.back();
+	}
+	auto it = std::lower_bound(containers.begin(), containers.end(), high_bits,
+	                           [](const Container &container, uint64_t value) { return container.high_bits < value; });
+	if (it != containers.end() && it->high_bits == high_bits) {
+		return *it;
+	}
+	return *containers.emplace(it, high_bits);
+}
+
+optional_ptr<const IcebergDeletionBitmap::Container> IcebergDeletionBitmap::FindContainer(uint64_t high_bits) const {
+	auto it = std::lower_bound(containers.begin(), containers.end(), high_bits,
+	                           [](const Container &container, uint64_t value) { return container.high_bits < value; });
+	if (it == containers.end() || it->high_bits != high_bits) {
+		return nullptr;
+	}
+	return &*it;
+}
+
+void IcebergDeletionBitmap::Add(uint64_t position) {
+	auto &container = GetOrCreateContainer(position >> CONTAINER_BITS);
+	auto low_bits = static_cast<uint16_t>(position & (CONTAINER_SIZE - 1));
+	if (container.IsBitmap()) {
+		container.bitmap[low_bits / 64] |= uint64_t(1) << (low_bits % 64);
+		return;
+	}
+	if (!container.array.empty() && container.array.back() >= low_bits) {
+		container.sorted = false;
+		finalized = false;
+	}
+	container.array.push_back(low_bits);
+	if (container.array.size() > MAX_ARRAY_SIZE) {
+		container.ConvertToBitmap();
+	}
+}
+
+void IcebergDeletionBitmap::AddBitmap(uint64_t high_bits, const uint64_t *words) {
+	auto &container = GetOrCreateContainer(high_bits);
+	if (!container.IsBitmap()) {
+		container.ConvertToBitmap();
+	}
+	for (idx_t i = 0; i < BITMAP_WORDS; i++) {
+		container.bitmap[i] |= words[i];
+	}
+}
+
+void IcebergDeletionBitmap::Merge(const IcebergDeletionBitmap &other) {
+	for (auto &container : other.containers) {
+		if (container.IsBitmap()) {
+			AddBitmap(container.high_bits, container.bitmap.data());
+			continue;
+		}
+		for (auto low_bits : container.array) {
+			Add((container.high_bits << CONTAINER_BITS) | low_bits);
+		}
+	}
+}
+
+//! ----------- Deletion Vector -----------
+//! See https://iceberg.apache.org/puffin-spec/#deletion-vector-v1-blob-type
+//! and https://github.com/RoaringBitmap/RoaringFormatSpec for the (64-bit) portable roaring format
+
+static constexpr uint8_t DELETION_VECTOR_MAGIC[] = {0xD1, 0xD3, 0x39, 0x64};
+static constexpr uint16_t SERIAL_COOKIE = 12347;
+static constexpr uint32_t SERIAL_COOKIE_NO_RUNCONTAINER = 12346;
+//! Below this amount of containers, a bitmap with run containers has no offset header
+static constexpr idx_t NO_OFFSET_THRESHOLD = 4;
+
+//! Reads the little-endian values of the serialized bitmap, checking that they are in bounds
+struct DeletionVectorReader {
+public:
+	DeletionVectorReader(const_data_ptr_t data, idx_t size) : data(data), size(size) {
+	}
+
+public:
+	template <class T>
+	T Read() {
+		T result;
+		std::memcpy(&result, ReadBytes(sizeof(T)), sizeof(T));
+		return result;
+	}
+	const_data_ptr_t ReadBytes(idx_t count) {
+		if (count > size - offset) {
+			throw InvalidInputException("Deletion vector is truncated, expected %llu more bytes at offset %llu",
+			                            count, offset);
+		}
+		auto result = data + offset;
+		offset += count;
+		return result;
+	}
+
+public:
+	const_data_ptr_t data;
+	idx_t size;
+	idx_t offset = 0;
+};
+
+void IcebergDeletionBitmap::AddDeletionVector(const_data_ptr_t blob, idx_t size) {
+	//! [length (4 bytes, big-endian)] [magic (4 bytes)] [64-bit portable roaring bitmap] [CRC-32 (4 bytes)]
+	//! where 'length' covers the magic and the bitmap
+	if (size < 12) {
+		throw InvalidInputException("Deletion vector blob of %llu bytes is too small", size);
+	}
+	auto length = (uint32_t(blob[0]) << 24) | (uint32_t(blob[1]) << 16) | (uint32_t(blob[2]) << 8) | uint32_t(blob[3]);
+	if (idx_t(length) + 8 != size) {
+		throw InvalidInputException("Deletion vector length %llu does not match the blob size %llu", idx_t(length),
+		                            size);
+	}
+	if (std::memcmp(blob + 4, DELETION_VECTOR_MAGIC, sizeof(DELETION_VECTOR_MAGIC)) != 0) {
+		throw InvalidInputException("Deletion vector blob does not start with the expected magic bytes");
+	}
+
+	DeletionVectorReader reader(blob + 8, length - 4);
+	//! The 64-bit bitmap is a sequence of 32-bit bitmaps, each with the upper 32 bits of their positions as key
+	auto bitmap_count = reader.Read<uint64_t>();
+	for (uint64_t bitmap_idx = 0; bitmap_idx < bitmap_count; bitmap_idx++) {
+		uint64_t key = reader.Read<uint32_t>();
+
+		auto cookie = reader.Read<uint32_t>();
+		idx_t container_count;
+		const_data_ptr_t run_flags = nullptr;
+		bool has_offsets;
+		if ((cookie & 0xFFFF) == SERIAL_COOKIE) {
+			container_count = (cookie >> 16) + 1;
+			run_flags = reader.ReadBytes((container_count + 7) / 8);
+			has_offsets = container_count >= NO_OFFSET_THRESHOLD;
+		} else if (cookie == SERIAL_COOKIE_NO_RUNCONTAINER) {
+			container_count = reader.Read<uint32_t>();
+			has_offsets = true;
+		} else {
+			throw InvalidInputException("Deletion vector contains a bitmap with an unrecognized cookie (%llu)",
+			                            idx_t(cookie));
+		}
+
+		//! The key (bits 16-31 of the positions) and cardinality of every container
+		vector<uint16_t> container_keys;
+		vector<idx_t> cardinalities;
+		for (idx_t i = 0; i < container_count; i++) {
+			container_keys.push_back(reader.Read<uint16_t>());
+			cardinalities.push_back(idx_t(reader.Read<uint16_t>()) + 1);
+		}
+		if (has_offsets) {
+			//! The containers are read in order, the offsets aren't needed
+			reader.ReadBytes(container_count * sizeof(uint32_t));
+		}
+
+		for (idx_t i = 0; i < container_count; i++) {
+			auto high_bits = (key << CONTAINER_BITS) | container_keys[i];
+			auto container_start = high_bits << CONTAINER_BITS;
+			if (run_flags && (run_flags[i / 8] >> (i % 8)) & 1) {
+				auto run_count = reader.Read<uint16_t>();
+				for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+					idx_t start = reader.Read<uint16_t>();
+					idx_t run_length = idx_t(reader.Read<uint16_t>()) + 1;
+					for (idx_t low_bits = start; low_bits < start + run_length && low_bits < CONTAINER_SIZE;
+					     low_bits++) {
+						Add(container_start | low_bits);
+					}
+				}
+			} else if (cardinalities[i] <= MAX_ARRAY_SIZE) {
+				for (idx_t j = 0; j < cardinalities[i]; j++) {
+					Add(container_start | reader.Read<uint16_t>());
+				}
+			} else {
+				uint64_t words[BITMAP_WORDS];
+				std::memcpy(words, reader.ReadBytes(sizeof(words)), sizeof(words));
+				AddBitmap(high_bits, words);
+			}
+		}
+	}
+}
+
+void IcebergDeletionBitmap::Finalize() {
+	if (finalized) {
+		return;
+	}
+	for (auto &container : containers) {
+		if (container.IsBitmap() || container.sorted) {
+			continue;
+		}
+		std::sort(container.array.begin(), container.array.end());
+		container.array.erase(std::unique(container.array.begin(), container.array.end()), container.array.end());
+		container.sorted = true;
+	}
+	finalized = true;
+}
+
+bool IcebergDeletionBitmap::Contains(uint64_t position) const {
+	D_ASSERT(finalized);
+	auto container = FindContainer(position >> CONTAINER_BITS);
+	if (!container) {
+		return false;
+	}
+	auto low_bits = static_cast<uint16_t>(position & (CONTAINER_SIZE - 1));
+	if (container->IsBitmap()) {
+		return container->bitmap[low_bits / 64] & (uint64_t(1) << (low_bits % 64));
+	}
+	return std::binary_search(container->array.begin(), container->array.end(), low_bits);
+}
+
+//! The mask of the bits [begin, end) of a word, with 0 <= begin < end <= 64
+static uint64_t RangeMask(idx_t begin, idx_t end) {
+	auto upper = end == 64 ? ~uint64_t(0) : (uint64_t(1) << end) - 1;
+	return upper & ~((uint64_t(1) << begin) - 1);
+}
+
+idx_t IcebergDeletionBitmap::Cardinality() const {
+	D_ASSERT(finalized);
+	idx_t result = 0;
+	for (auto &container : containers) {
+		if (!container.IsBitmap()) {
+			result += container.array.size();
+			continue;
+		}
+		//! The words have the layout of a validity mask, the set bits are counted like its valid rows
+		D_ASSERT(container.bitmap.size() == BITMAP_WORDS);
+		ValidityMask mask(const_cast<validity_t *>(container.bitmap.data()), CONTAINER_SIZE);
+		result += mask.CountValid(CONTAINER_SIZE);
+	}
+	return result;
+}
+
+bool IcebergDeletionBitmap::IsEmpty(uint64_t start, idx_t count) const {
+	D_ASSERT(finalized);
+	if (containers.empty() || count == 0) {
+		return true;
+	}
+	auto end = start + count;
+	for (auto high_bits = start >> CONTAINER_BITS; high_bits <= (end - 1) >> CONTAINER_BITS; high_bits++) {
+		auto container = FindContainer(high_bits);
+		if (!container) {
+			continue;
+		}
+		auto container_start = high_bits << CONTAINER_BITS;
+		auto begin = MaxValue<uint64_t>(start, container_start) - container_start;
+		auto stop = MinValue<uint64_t>(end, container_start + CONTAINER_SIZE) - container_start;
+		if (container->IsBitmap()) {
+			for (auto word_idx = begin / 64; word_idx <= (stop - 1) / 64; word_idx++) {
+				auto word_start = word_idx * 64;
+				auto mask = RangeMask(MaxValue<uint64_t>(begin, word_start) - word_start,
+				                      MinValue<uint64_t>(stop, word_start + 64) - word_start);
+				if (container->bitmap[word_idx] & mask) {
+					return false;
+				}
+			}
+			continue;
+		}
+		auto it = std::lower_bound(container->array.begin(), container->array.end(), begin);
+		if (it != container->array.end() && *it < stop) {
+			return false;
+		}
+	}
+	return true;
+}
+
+idx_t IcebergDeletionBitmap::Select(uint64_t start, idx_t count, SelectionVector &result) const {
+	D_ASSERT(finalized);
+	idx_t selected = 0;
+	idx_t offset = 0;
+	while (offset < count) {
+		auto position = start + offset;
+		auto high_bits = position >> CONTAINER_BITS;
+		auto container_start = high_bits << CONTAINER_BITS;
+		auto begin = position - container_start;
+		auto length = MinValue<idx_t>(count - offset, CONTAINER_SIZE - begin);
+		auto stop = begin + length;
+
+		auto container = FindContainer(high_bits);
+		if (!container) {
+			//! Nothing is deleted in this part of the range
+			for (idx_t i = 0; i < length; i++) {
+				result.set_index(selected++, offset + i);
+			}
+		} else if (container->IsBitmap()) {
+			//! Select the bits that are not set, a word at a time
+			for (auto word_idx = begin / 64; word_idx <= (stop - 1) / 64; word_idx++) {
+				auto word_start = word_idx * 64;
+				auto mask = RangeMask(MaxValue<uint64_t>(begin, word_start) - word_start,
+				                      MinValue<uint64_t>(stop, word_start + 64) - word_start);
+				auto remaining = ~container->bitmap[word_idx] & mask;
+				while (remaining) {
+					auto bit = NumericCast<idx_t>(CountZeros<uint64_t>::Trailing(remaining));
+					result.set_index(selected++, offset + (word_start + bit - begin));
+					remaining &= remaining - 1;
+				}
+			}
+		} else {
+			//! Select the runs between the deleted positions
+			auto &array = container->array;
+			auto it = std::lower_bound(array.begin(), array.end(), begin);
+			auto current = begin;
+			for (; it != array.end() && *it < stop; it++) {
+				for (; current < *it; current++) {
+					result.set_index(selected++, offset + (current - begin));
+				}
+				current = *it + 1;
+			}
+			for (; current < stop; current++) {
+				result.set_index(selected++, offset + (current - begin));
+			}
+		}
+		offset += length;
+	}
+	return selected;
+}
+
+} // namespace duckdb
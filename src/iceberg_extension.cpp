@@ -20,6 +20,9 @@
 #include "storage/authorization/sigv4.hpp"
 #include "iceberg_utils.hpp"
 #include "iceberg_logging.hpp"
+#include "iceberg_options.hpp"
+#include "iceberg_manifest_cache.hpp"
+#include "iceberg_optimizer.hpp"
 
 namespace duckdb {
 
@@ -37,6 +40,11 @@ public:
 	}
 };
 
+static void ValidateCacheSize(ClientContext &context, SetScope scope, Value &parameter) {
+	//! Verify the size can be parsed
+	(void)IcebergManifestCache::ParseMemoryLimit(parameter.ToString());
+}
+
 static void LoadInternal(DatabaseInstance &instance) {
 	ExtensionHelper::AutoLoadExtension(instance, "parquet");
 	if (!instance.ExtensionIsLoaded("parquet")) {
@@ -50,6 +58,40 @@ static void LoadInternal(DatabaseInstance &instance) {
 	                          "could result in reading an uncommitted version.",
 	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
 
+	config.AddExtensionOption(MANIFEST_PREFETCH_COUNT_CONFIG_VARIABLE,
+	                          "The amount of data manifests to read ahead of the scan (0 disables the read-ahead), "
+	                          "defaults to the amount of threads.",
+	                          LogicalType::UBIGINT);
+
+	config.AddExtensionOption(MANIFEST_CACHE_SIZE_CONFIG_VARIABLE,
+	                          "The memory budget of the cache of decoded manifests and manifest lists, '0' disables "
+	                          "the cache.",
+	                          LogicalType::VARCHAR, Value(DEFAULT_MANIFEST_CACHE_SIZE), ValidateCacheSize);
+
+	config.AddExtensionOption(METADATA_CACHE_ENTRIES_CONFIG_VARIABLE,
+	                          "The maximum amount of parsed metadata files to cache, '0' disables the cache.",
+	                          LogicalType::UBIGINT, Value::UBIGINT(DEFAULT_METADATA_CACHE_ENTRIES));
+
+	config.AddExtensionOption(MANIFEST_DISK_CACHE_DIRECTORY_CONFIG_VARIABLE,
+	                          "The directory to persist decoded manifests in, so they survive a restart. The on-disk "
+	                          "cache is disabled when this is not set.",
+	                          LogicalType::VARCHAR);
+
+	config.AddExtensionOption(MANIFEST_DISK_CACHE_SIZE_CONFIG_VARIABLE,
+	                          "The disk quota of the on-disk manifest cache (e.g. '1GB').", LogicalType::VARCHAR,
+	                          Value(DEFAULT_MANIFEST_DISK_CACHE_SIZE), ValidateCacheSize);
+
+	config.AddExtensionOption(COLUMN_STATISTICS_CONFIG_VARIABLE,
+	                          "Provide the min/max and null statistics of the columns (from the metrics of the data "
+	                          "files) to the optimizer. This reads every data manifest of the snapshot (in parallel) "
+	                          "while planning.",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+
+	config.AddExtensionOption(METADATA_AGGREGATES_CONFIG_VARIABLE,
+	                          "Answer count(*), count, min and max without a GROUP BY from the metrics of the data "
+	                          "files where possible, only scanning the data files that can't be answered.",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+
 	// Iceberg Table Functions
 	for (auto &fun : IcebergFunctions::GetTableFunctions(instance)) {
 		ExtensionUtil::RegisterFunction(instance, fun);
@@ -70,6 +112,9 @@ static void LoadInternal(DatabaseInstance &instance) {
 	OAuth2Authorization::SetCatalogSecretParameters(secret_function);
 	ExtensionUtil::RegisterFunction(instance, secret_function);
 
+	// Answer aggregates from the manifests where possible
+	config.optimizer_extensions.push_back(IcebergOptimizer::GetOptimizerExtension());
+
 	auto &log_manager = instance.GetLogManager();
 	log_manager.RegisterLogType(make_uniq<IcebergLogType>());
 
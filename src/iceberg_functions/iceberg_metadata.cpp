@@ -95,14 +95,13 @@ static unique_ptr<FunctionData> IcebergMetaDataBind(ClientContext &context, Tabl
 	}
 
 	auto iceberg_meta_path = IcebergTableMetadata::GetMetaDataPath(context, input_string, fs, options);
-	auto table_metadata = IcebergTableMetadata::Parse(iceberg_meta_path, fs, options.metadata_compression_codec);
-	auto metadata = IcebergTableMetadata::FromTableMetadata(table_metadata);
+	auto metadata = IcebergTableMetadata::Load(context, iceberg_meta_path, fs, options.metadata_compression_codec);
 
-	auto snapshot_to_scan = metadata.GetSnapshot(options.snapshot_lookup);
+	auto snapshot_to_scan = metadata->GetSnapshot(options.snapshot_lookup);
 
 	if (snapshot_to_scan) {
 		ret->iceberg_table =
-		    make_uniq<IcebergTable>(IcebergTable::Load(input_string, metadata, *snapshot_to_scan, context, options));
+		    make_uniq<IcebergTable>(IcebergTable::Load(input_string, *metadata, *snapshot_to_scan, context, options));
 	}
 
 	auto manifest_types = IcebergManifest::Types();
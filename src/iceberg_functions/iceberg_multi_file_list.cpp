@@ -6,8 +6,12 @@
 
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/execution_context.hpp"
 #include "duckdb/main/extension_util.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
@@ -20,14 +24,30 @@
 #include "metadata/iceberg_predicate_stats.hpp"
 #include "metadata/iceberg_table_metadata.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
+//! The field id of the 'file_path' column of positional delete files
+static constexpr int32_t POSITIONAL_DELETE_FILE_PATH_FIELD_ID = 2147483546;
+
 IcebergMultiFileList::IcebergMultiFileList(ClientContext &context_p, shared_ptr<IcebergScanInfo> scan_info,
                                            const string &path, const IcebergOptions &options)
     : MultiFileList(vector<OpenFileInfo> {}, FileGlobOptions::ALLOW_EMPTY), context(context_p), scan_info(scan_info),
       path(path), lock(), options(options) {
 }
 
+IcebergMultiFileList::~IcebergMultiFileList() {
+	if (!prefetch_executor) {
+		return;
+	}
+	//! The reads that haven't started yet are no longer needed, wait for the ones that have
+	for (auto &prefetch : prefetched_manifests) {
+		prefetch->Cancel();
+	}
+	prefetch_executor->WorkOnTasks();
+}
+
 string IcebergMultiFileList::ToDuckDBPath(const string &raw_path) {
 	return raw_path;
 }
@@ -63,8 +83,8 @@ void IcebergMultiFileList::Bind(vector<LogicalType> &return_types, vector<string
 		auto iceberg_path = IcebergUtils::GetStorageLocation(context, input_string);
 		auto &fs = FileSystem::GetFileSystem(context);
 		auto iceberg_meta_path = IcebergTableMetadata::GetMetaDataPath(context, iceberg_path, fs, options);
-		auto table_metadata = IcebergTableMetadata::Parse(iceberg_meta_path, fs, options.metadata_compression_codec);
-		auto metadata = make_uniq<IcebergTableMetadata>(IcebergTableMetadata::FromTableMetadata(table_metadata));
+		auto metadata =
+		    IcebergTableMetadata::Load(context, iceberg_meta_path, fs, options.metadata_compression_codec);
 
 		auto found_snapshot = metadata->GetSnapshot(options.snapshot_lookup);
 		shared_ptr<IcebergTableSchema> schema;
@@ -86,10 +106,8 @@ void IcebergMultiFileList::Bind(vector<LogicalType> &return_types, vector<string
 		return_types.push_back(schema_entry->type);
 	}
 
+	//! The schema is shared with other scans (through the metadata cache), so the deduplicated names are only kept here
 	QueryResult::DeduplicateColumns(names);
-	for (idx_t i = 0; i < names.size(); i++) {
-		schema[i]->name = names[i];
-	}
 
 	have_bound = true;
 	this->names = names;
@@ -114,10 +132,25 @@ unique_ptr<IcebergMultiFileList> IcebergMultiFileList::PushdownInternal(ClientCo
 		}
 	}
 
+	for (auto &entry : result_filter_set.filters) {
+		IcebergPredicate::PrepareFilter(*entry.second);
+	}
 	filtered_list->table_filters = std::move(result_filter_set);
+	filtered_list->pruning_program =
+	    IcebergPruningProgram::Compile(filtered_list->table_filters, filtered_list->GetSchema());
 	filtered_list->names = names;
 	filtered_list->types = types;
 	filtered_list->have_bound = true;
+	filtered_list->skipped_data_files = skipped_data_files;
+	{
+		lock_guard<mutex> guard(lock);
+		if (initialized && scan_info->snapshot) {
+			//! Reuse the manifest list we already read
+			auto manifests = make_shared_ptr<vector<IcebergManifest>>(data_manifests);
+			manifests->insert(manifests->end(), delete_manifests.begin(), delete_manifests.end());
+			filtered_list->parent_manifests = std::move(manifests);
+		}
+	}
 	return filtered_list;
 }
 
@@ -172,7 +205,7 @@ unique_ptr<MultiFileList> IcebergMultiFileList::ComplexFilterPushdown(ClientCont
 
 vector<OpenFileInfo> IcebergMultiFileList::GetAllFiles() {
 	vector<OpenFileInfo> file_list;
-	for (idx_t i = 0; i < data_files.size(); i++) {
+	for (idx_t i = 0; i < data_files.Count(); i++) {
 		file_list.push_back(GetFile(i));
 	}
 	return file_list;
@@ -182,23 +215,47 @@ FileExpandResult IcebergMultiFileList::GetExpandResult() {
 	// GetFile(1) will ensure files with index 0 and index 1 are expanded if they are available
 	GetFile(1);
 
-	if (data_files.size() > 1) {
+	if (data_files.Count() > 1) {
 		return FileExpandResult::MULTIPLE_FILES;
-	} else if (data_files.size() == 1) {
+	} else if (data_files.Count() == 1) {
 		return FileExpandResult::SINGLE_FILE;
 	}
 
 	return FileExpandResult::NO_FILES;
 }
 
+bool IcebergMultiFileList::TryGetManifestFileCount(idx_t &result) const {
+	if (!table_filters.filters.empty() || skipped_data_files) {
+		//! The filters (or skipped files) can skip entries of a manifest, the counters don't reflect that
+		return false;
+	}
+	result = 0;
+	for (auto &manifest : data_manifests) {
+		if (!manifest.has_file_counts) {
+			return false;
+		}
+		result += manifest.added_files_count + manifest.existing_files_count;
+	}
+	return true;
+}
+
 idx_t IcebergMultiFileList::GetTotalFileCount() {
-	// FIXME: the 'added_files_count' + the 'existing_files_count'
-	// in the Manifest List should give us this information without scanning the manifest list
-	idx_t i = data_files.size();
+	{
+		lock_guard<mutex> guard(lock);
+		if (!initialized) {
+			InitializeFiles(guard);
+		}
+		//! Without filters the 'added_files_count' + the 'existing_files_count' of the manifest list give us the count
+		idx_t file_count;
+		if (TryGetManifestFileCount(file_count)) {
+			return file_count;
+		}
+	}
+	idx_t i = data_files.Count();
 	while (!GetFile(i).path.empty()) {
 		i++;
 	}
-	return data_files.size();
+	return data_files.Count();
 }
 
 unique_ptr<NodeStatistics> IcebergMultiFileList::GetCardinality(ClientContext &context) {
@@ -209,8 +266,11 @@ unique_ptr<NodeStatistics> IcebergMultiFileList::GetCardinality(ClientContext &c
 		return nullptr;
 	}
 
-	//! Make sure we have fetched all manifests
-	(void)GetTotalFileCount();
+	//! Make sure we have read the manifest list, the manifests themselves don't have to be read
+	lock_guard<mutex> guard(lock);
+	if (!initialized) {
+		InitializeFiles(guard);
+	}
 
 	for (idx_t i = 0; i < data_manifests.size(); i++) {
 		cardinality += data_manifests[i].added_rows_count;
@@ -222,86 +282,267 @@ unique_ptr<NodeStatistics> IcebergMultiFileList::GetCardinality(ClientContext &c
 	return make_uniq<NodeStatistics>(cardinality, cardinality);
 }
 
-static void DeserializeBounds(const Value &lower_bound, const Value &upper_bound, const string &name,
-                              const LogicalType &type, IcebergPredicateStats &out) {
-	if (lower_bound.IsNull()) {
-		out.lower_bound = Value(type);
-	} else {
-		D_ASSERT(lower_bound.type().id() == LogicalTypeId::BLOB);
-		auto lower_bound_blob = lower_bound.GetValueUnsafe<string_t>();
-		auto deserialized_lower_bound = IcebergValue::DeserializeValue(lower_bound_blob, type);
-		if (deserialized_lower_bound.HasError()) {
-			throw InvalidConfigurationException("Column %s lower bound deserialization failed: %s", name,
-			                                    deserialized_lower_bound.GetError());
-		}
-		out.lower_bound = deserialized_lower_bound.GetValue();
+unique_ptr<BaseStatistics> IcebergMultiFileList::GetStatistics(column_t column_index) {
+	if (!IcebergTableStatistics::IsEnabled(context)) {
+		return nullptr;
 	}
+	if (!GetSnapshot() || column_index >= GetSchema().columns.size()) {
+		//! Empty table or a virtual column
+		return nullptr;
+	}
+	lock_guard<mutex> guard(lock);
+	if (!statistics) {
+		statistics = IcebergTableStatistics::Get(context, *this);
+	}
+	return statistics->GetColumnStatistics(column_index);
+}
 
-	if (upper_bound.IsNull()) {
-		out.upper_bound = Value(type);
-	} else {
-		D_ASSERT(upper_bound.type().id() == LogicalTypeId::BLOB);
-		auto upper_bound_blob = upper_bound.GetValueUnsafe<string_t>();
-		auto deserialized_upper_bound = IcebergValue::DeserializeValue(upper_bound_blob, type);
-		if (deserialized_upper_bound.HasError()) {
-			throw InvalidConfigurationException("Column %s upper bound deserialization failed: %s", name,
-			                                    deserialized_upper_bound.GetError());
+bool IcebergManifestPrefetch::TryClaim() {
+	lock_guard<mutex> guard(lock);
+	if (state != IcebergManifestReadState::PENDING) {
+		return false;
+	}
+	state = IcebergManifestReadState::RUNNING;
+	return true;
+}
+
+void IcebergManifestPrefetch::Finish(ErrorData error_p) {
+	{
+		lock_guard<mutex> guard(lock);
+		D_ASSERT(state == IcebergManifestReadState::RUNNING);
+		state = IcebergManifestReadState::FINISHED;
+		error = std::move(error_p);
+	}
+	finished.notify_all();
+}
+
+void IcebergManifestPrefetch::Cancel() {
+	lock_guard<mutex> guard(lock);
+	if (state == IcebergManifestReadState::PENDING) {
+		state = IcebergManifestReadState::CANCELLED;
+	}
+}
+
+void IcebergManifestPrefetch::Wait() {
+	unique_lock<mutex> guard(lock);
+	finished.wait(guard, [&]() { return state == IcebergManifestReadState::FINISHED; });
+	if (error.HasError()) {
+		error.Throw();
+	}
+}
+
+IcebergManifestReadTask::IcebergManifestReadTask(TaskExecutor &executor, const IcebergMultiFileList &multi_file_list,
+                                                 shared_ptr<IcebergManifestPrefetch> prefetch)
+    : BaseExecutorTask(executor), multi_file_list(multi_file_list), prefetch(std::move(prefetch)) {
+}
+
+void IcebergManifestReadTask::ExecuteTask() {
+	if (!prefetch->TryClaim()) {
+		//! Already read by the scan, or the scan no longer needs it
+		return;
+	}
+	multi_file_list.ReadDataManifest(*prefetch);
+}
+
+void IcebergMultiFileList::ReadDataManifest(const IcebergManifest &manifest,
+                                            IcebergManifestEntryStore &result) const {
+	auto iceberg_path = GetPath();
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto manifest_entry_full_path = options.allow_moved_paths
+	                                    ? IcebergUtils::GetFullPath(iceberg_path, manifest.manifest_path, fs)
+	                                    : manifest.manifest_path;
+
+	ManifestFileReader manifest_reader(GetMetadata().iceberg_version);
+	//! The metrics are only used to filter the data files
+	manifest_reader.SetReadMetrics(!table_filters.filters.empty());
+	ConfigureDataManifestReader(manifest, manifest_reader);
+
+	auto cached = GetCachedDataManifest(manifest, manifest_entry_full_path);
+	if (cached) {
+		manifest_reader.ReadCached(context, cached->data_files, result);
+		return;
+	}
+	auto scan = make_uniq<AvroScan>("IcebergManifest", context, manifest_entry_full_path, manifest.manifest_length);
+	manifest_reader.Initialize(std::move(scan));
+	manifest_reader.SetSequenceNumber(manifest.sequence_number);
+	manifest_reader.SetPartitionSpecID(manifest.partition_spec_id);
+
+	while (!manifest_reader.Finished()) {
+		manifest_reader.Read(STANDARD_VECTOR_SIZE, result);
+	}
+}
+
+void IcebergMultiFileList::ConfigureDataManifestReader(const IcebergManifest &manifest,
+                                                       ManifestFileReader &manifest_reader) const {
+	if (!table_filters.filters.empty()) {
+		//! The entries are filtered on the scanned chunk, before they are materialized
+		manifest_reader.SetFilters(table_filters, GetSchema(), pruning_program.get());
+		auto &partition_specs = GetMetadata().partition_specs;
+		auto partition_spec_it = partition_specs.find(manifest.partition_spec_id);
+		if (partition_spec_it != partition_specs.end() && partition_spec_it->second.IsPartitioned()) {
+			manifest_reader.SetPartitionFilters(table_filters, GetSchema(), partition_spec_it->second);
 		}
-		out.upper_bound = deserialized_upper_bound.GetValue();
+	}
+	if (skipped_data_files) {
+		manifest_reader.SetSkippedFiles(*skipped_data_files);
 	}
 }
 
-bool IcebergMultiFileList::FileMatchesFilter(IcebergManifestEntry &file) {
-	D_ASSERT(!table_filters.filters.empty());
+shared_ptr<IcebergCachedManifest> IcebergMultiFileList::GetCachedDataManifest(const IcebergManifest &manifest,
+                                                                              const string &full_path) const {
+	auto memory_limit = IcebergManifestCache::GetMemoryLimit(context);
+	if (memory_limit == 0) {
+		return nullptr;
+	}
+	auto &cache = IcebergManifestCache::Get(context);
+	auto result = cache.Get(full_path);
+	if (result) {
+		return result;
+	}
+	//! The cached entries serve every scan of the manifest, so all of them are read with all their metrics
+	ManifestFileReader manifest_reader(GetMetadata().iceberg_version);
+	manifest_reader.Initialize(make_uniq<AvroScan>("IcebergManifest", context, full_path, manifest.manifest_length));
+	manifest_reader.SetSequenceNumber(manifest.sequence_number);
+	manifest_reader.SetPartitionSpecID(manifest.partition_spec_id);
+	result = make_shared_ptr<IcebergCachedManifest>();
+	while (!manifest_reader.Finished()) {
+		manifest_reader.Read(STANDARD_VECTOR_SIZE, result->data_files);
+	}
+	cache.Put(full_path, result, memory_limit);
+	return result;
+}
 
-	auto &filters = table_filters.filters;
-	auto &schema = GetSchema().columns;
+void IcebergMultiFileList::ReadDataManifestMetrics(const IcebergManifest &manifest,
+                                                   const unordered_set<int32_t> &field_ids,
+                                                   IcebergManifestEntryStore &result) const {
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto manifest_full_path = options.allow_moved_paths
+	                              ? IcebergUtils::GetFullPath(GetPath(), manifest.manifest_path, fs)
+	                              : manifest.manifest_path;
+	ManifestFileReader manifest_reader(GetMetadata().iceberg_version);
+	manifest_reader.metrics_field_ids.insert(field_ids.begin(), field_ids.end());
+	auto cached = GetCachedDataManifest(manifest, manifest_full_path);
+	if (cached) {
+		manifest_reader.ReadCached(context, cached->data_files, result);
+		return;
+	}
+	manifest_reader.Initialize(
+	    make_uniq<AvroScan>("IcebergManifest", context, manifest_full_path, manifest.manifest_length));
+	manifest_reader.SetSequenceNumber(manifest.sequence_number);
+	manifest_reader.SetPartitionSpecID(manifest.partition_spec_id);
+	while (!manifest_reader.Finished()) {
+		manifest_reader.Read(STANDARD_VECTOR_SIZE, result);
+	}
+}
 
-	for (idx_t column_id = 0; column_id < schema.size(); column_id++) {
-		// FIXME: is there a potential mismatch between column_id / field_id lurking here?
-		auto &column = *schema[column_id];
-		auto it = filters.find(column_id);
+vector<IcebergManifest> IcebergMultiFileList::ReadManifestList() const {
+	auto &snapshot = *GetSnapshot();
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto manifest_list_full_path = options.allow_moved_paths
+	                                   ? IcebergUtils::GetFullPath(GetPath(), snapshot.manifest_list, fs)
+	                                   : snapshot.manifest_list;
+	return IcebergManifestCache::ReadManifestList(context, manifest_list_full_path, GetMetadata().iceberg_version);
+}
 
-		if (it == filters.end()) {
-			continue;
+bool IcebergMultiFileList::ReadDataFileMetrics(const unordered_set<int32_t> &field_ids,
+                                               IcebergManifestEntryStore &result) {
+	if (!GetSnapshot()) {
+		return true;
+	}
+	auto manifests = ReadManifestList();
+	for (auto &manifest : manifests) {
+		if (manifest.content == IcebergManifestContentType::DELETE) {
+			return false;
 		}
-		if (file.lower_bounds.empty() || file.upper_bounds.empty()) {
-			//! There are no bounds statistics for the file, can't filter
+	}
+
+	vector<IcebergManifest> data_manifests;
+	for (auto &manifest : manifests) {
+		if (!ManifestMatchesFilter(manifest)) {
+			//! None of the data files match the filters
 			continue;
 		}
+		data_manifests.push_back(std::move(manifest));
+	}
+	ReadDataFileMetrics(data_manifests, field_ids, result);
+	return true;
+}
 
-		auto &source_id = column.id;
-		auto lower_bound_it = file.lower_bounds.find(source_id);
-		auto upper_bound_it = file.upper_bounds.find(source_id);
-		Value lower_bound;
-		Value upper_bound;
-		if (lower_bound_it != file.lower_bounds.end()) {
-			lower_bound = lower_bound_it->second;
+void IcebergMultiFileList::ReadDataFileMetrics(const vector<IcebergManifest> &manifests,
+                                               const unordered_set<int32_t> &field_ids,
+                                               IcebergManifestEntryStore &result) const {
+	vector<shared_ptr<IcebergManifestPrefetch>> reads;
+	TaskExecutor executor(context);
+	for (auto &manifest : manifests) {
+		auto read = make_shared_ptr<IcebergManifestPrefetch>(manifest);
+		read->metrics_field_ids = &field_ids;
+		executor.ScheduleTask(make_uniq<IcebergManifestReadTask>(executor, *this, read));
+		reads.push_back(std::move(read));
+	}
+	//! This thread reads the manifests in order as well, whatever the scheduler didn't pick up yet
+	for (auto &read : reads) {
+		if (read->TryClaim()) {
+			ReadDataManifest(*read);
 		}
-		if (upper_bound_it != file.upper_bounds.end()) {
-			upper_bound = upper_bound_it->second;
+	}
+	executor.WorkOnTasks();
+	for (auto &read : reads) {
+		read->Wait();
+		//! Merged in the order of the manifest list, regardless of the order the reads finished in
+		result.Merge(read->entries);
+	}
+}
+
+void IcebergMultiFileList::ReadDataManifest(IcebergManifestPrefetch &prefetch) const {
+	try {
+		if (prefetch.metrics_field_ids) {
+			ReadDataManifestMetrics(prefetch.manifest, *prefetch.metrics_field_ids, prefetch.entries);
+		} else {
+			ReadDataManifest(prefetch.manifest, prefetch.entries);
 		}
+	} catch (std::exception &ex) {
+		prefetch.Finish(ErrorData(ex));
+		return;
+	} catch (...) {
+		prefetch.Finish(ErrorData(ExceptionType::UNKNOWN_TYPE, "Unknown exception while reading a data manifest"));
+		return;
+	}
+	prefetch.Finish();
+}
 
-		IcebergPredicateStats stats;
-		DeserializeBounds(lower_bound, upper_bound, column.name, column.type, stats);
-		auto null_counts_it = file.null_value_counts.find(source_id);
-		if (null_counts_it != file.null_value_counts.end()) {
-			auto &null_counts = null_counts_it->second;
-			stats.has_null = null_counts != 0;
+void IcebergMultiFileList::PrefetchDataManifests() {
+	auto scheduled = NumericCast<int64_t>(prefetched_manifests.size());
+	while (prefetched_manifests.size() <= prefetch_count && current_data_manifest + scheduled != data_manifests.end()) {
+		auto prefetch = make_shared_ptr<IcebergManifestPrefetch>(*(current_data_manifest + scheduled));
+		prefetched_manifests.push_back(prefetch);
+		scheduled++;
+		if (prefetch_count == 0) {
+			//! Read-ahead is disabled, the manifest is read when it's needed
+			break;
 		}
-		auto nan_counts_it = file.nan_value_counts.find(source_id);
-		if (nan_counts_it != file.nan_value_counts.end()) {
-			auto &nan_counts = nan_counts_it->second;
-			stats.has_nan = nan_counts != 0;
+		if (!prefetch_executor) {
+			prefetch_executor = make_uniq<TaskExecutor>(context);
 		}
+		prefetch_executor->ScheduleTask(make_uniq<IcebergManifestReadTask>(*prefetch_executor, *this, prefetch));
+	}
+}
 
-		auto &filter = *it->second;
-		if (!IcebergPredicate::MatchBounds(filter, stats, IcebergTransform::Identity())) {
-			//! If any predicate fails, exclude the file
-			return false;
-		}
+void IcebergMultiFileList::ExpandDataManifest() {
+	D_ASSERT(current_data_manifest != data_manifests.end());
+	PrefetchDataManifests();
+	D_ASSERT(!prefetched_manifests.empty());
+
+	auto prefetch = std::move(prefetched_manifests.front());
+	prefetched_manifests.pop_front();
+	if (prefetch->TryClaim()) {
+		//! Not picked up by the scheduler (yet), read it on this thread
+		ReadDataManifest(*prefetch);
 	}
-	return true;
+	prefetch->Wait();
+
+	//! Manifests are consumed in order, so the index of a file does not depend on the order the reads finish in
+	data_files.Merge(prefetch->entries);
+	current_data_manifest++;
 }
 
 OpenFileInfo IcebergMultiFileList::GetFile(idx_t file_id) {
@@ -314,68 +555,20 @@ OpenFileInfo IcebergMultiFileList::GetFile(idx_t file_id) {
 		return OpenFileInfo();
 	}
 
-	auto iceberg_path = GetPath();
-	auto &fs = FileSystem::GetFileSystem(context);
-
-	// Read enough data files
-	while (file_id >= data_files.size()) {
-		if (data_manifest_reader->Finished()) {
-			if (current_data_manifest == data_manifests.end()) {
-				break;
-			}
-			auto &manifest = *current_data_manifest;
-			auto manifest_entry_full_path = options.allow_moved_paths
-			                                    ? IcebergUtils::GetFullPath(iceberg_path, manifest.manifest_path, fs)
-			                                    : manifest.manifest_path;
-			auto scan = make_uniq<AvroScan>("IcebergManifest", context, manifest_entry_full_path);
-			data_manifest_reader->Initialize(std::move(scan));
-			data_manifest_reader->SetSequenceNumber(manifest.sequence_number);
-			data_manifest_reader->SetPartitionSpecID(manifest.partition_spec_id);
-		}
-
-		idx_t remaining = (file_id + 1) - data_files.size();
-		if (!table_filters.filters.empty()) {
-			// FIXME: push down the filter into the 'read_avro' scan, so the entries that don't match are just filtered
-			// out
-			vector<IcebergManifestEntry> intermediate_entries;
-			data_manifest_reader->Read(remaining, intermediate_entries);
-
-			for (auto &entry : intermediate_entries) {
-				if (!FileMatchesFilter(entry)) {
-					DUCKDB_LOG(context, IcebergLogType, "Iceberg Filter Pushdown, skipped 'data_file': '%s'",
-					           entry.file_path);
-					//! Skip this file
-					continue;
-				}
-				data_files.push_back(entry);
-			}
-		} else {
-			data_manifest_reader->Read(remaining, data_files);
-		}
-
-		if (data_manifest_reader->Finished()) {
-			current_data_manifest++;
-			continue;
-		}
+	// Read enough data files, the manifests that follow are read ahead in the background
+	while (file_id >= data_files.Count() && current_data_manifest != data_manifests.end()) {
+		ExpandDataManifest();
 	}
-#ifdef DEBUG
-	for (auto &entry : data_files) {
-		D_ASSERT(entry.content == IcebergManifestEntryContentType::DATA);
-		D_ASSERT(entry.status != IcebergManifestEntryStatusType::DELETED);
-	}
-#endif
 
-	if (file_id >= data_files.size()) {
+	if (file_id >= data_files.Count()) {
 		return OpenFileInfo();
 	}
 
-	D_ASSERT(file_id < data_files.size());
-	const auto &data_file = data_files[file_id];
-	const auto &path = data_file.file_path;
-
-	if (!StringUtil::CIEquals(data_file.file_format, "parquet")) {
+	auto path = data_files.GetFilePath(file_id).GetString();
+	auto file_format = data_files.GetFileFormat(file_id).GetString();
+	if (!StringUtil::CIEquals(file_format, "parquet")) {
 		throw NotImplementedException("File format '%s' not supported, only supports 'parquet' currently",
-		                              data_file.file_format);
+		                              file_format);
 	}
 
 	string file_path = path;
@@ -386,7 +579,7 @@ OpenFileInfo IcebergMultiFileList::GetFile(idx_t file_id) {
 	}
 	OpenFileInfo res(file_path);
 	auto extended_info = make_shared_ptr<ExtendedOpenFileInfo>();
-	extended_info->options["file_size"] = Value::UBIGINT(data_file.file_size_in_bytes);
+	extended_info->options["file_size"] = Value::UBIGINT(data_files.GetFileSizeInBytes(file_id));
 	// files managed by Iceberg are never modified - we can keep them cached
 	extended_info->options["validate_external_file_cache"] = Value::BOOLEAN(false);
 	// etag / last modified time can be set to dummy values
@@ -424,10 +617,11 @@ bool IcebergMultiFileList::ManifestMatchesFilter(IcebergManifest &manifest) {
 	}
 
 	auto &schema = GetSchema().columns;
-	unordered_map<uint64_t, idx_t> source_to_column_id;
-	for (idx_t i = 0; i < schema.size(); i++) {
-		auto &column = schema[i];
-		source_to_column_id[static_cast<uint64_t>(column->id)] = i;
+	if (source_to_column_id.empty()) {
+		for (idx_t i = 0; i < schema.size(); i++) {
+			auto &column = schema[i];
+			source_to_column_id[static_cast<uint64_t>(column->id)] = i;
+		}
 	}
 
 	for (idx_t i = 0; i < field_summaries.size(); i++) {
@@ -445,7 +639,7 @@ bool IcebergMultiFileList::ManifestMatchesFilter(IcebergManifest &manifest) {
 		auto &column = schema[column_id];
 		IcebergPredicateStats stats;
 		auto result_type = field.transform.GetSerializedType(column->type);
-		DeserializeBounds(field_summary.lower_bound, field_summary.upper_bound, column->name, result_type, stats);
+		stats.DeserializeBounds(field_summary.lower_bound, field_summary.upper_bound, column->name, result_type);
 		stats.has_nan = field_summary.contains_nan;
 		stats.has_null = field_summary.contains_null;
 
@@ -465,31 +659,27 @@ void IcebergMultiFileList::InitializeFiles(lock_guard<mutex> &guard) {
 	if (!scan_info->snapshot) {
 		// we are reading from an empty table
 		current_data_manifest = data_manifests.begin();
-		current_delete_manifest = delete_manifests.begin();
+		deletes_loaded = true;
 		return;
 	}
 
-	//! Load the snapshot
-	auto iceberg_path = GetPath();
-	auto &snapshot = *GetSnapshot();
-	auto &metadata = GetMetadata();
-	auto &fs = FileSystem::GetFileSystem(context);
-
-	data_manifest_reader = make_uniq<ManifestFileReader>(metadata.iceberg_version);
-	delete_manifest_reader = make_uniq<ManifestFileReader>(metadata.iceberg_version);
-	manifest_list = make_uniq<ManifestListReader>(metadata.iceberg_version);
-
-	// Read the manifest list, we need all the manifests to determine if we've seen all deletes
-	auto manifest_list_full_path = options.allow_moved_paths
-	                                   ? IcebergUtils::GetFullPath(iceberg_path, snapshot.manifest_list, fs)
-	                                   : snapshot.manifest_list;
-
-	auto scan = make_uniq<AvroScan>("IcebergManifestList", context, manifest_list_full_path);
-	manifest_list->Initialize(std::move(scan));
+	Value prefetch_setting;
+	(void)context.TryGetCurrentSetting(MANIFEST_PREFETCH_COUNT_CONFIG_VARIABLE, prefetch_setting);
+	if (prefetch_setting.IsNull()) {
+		prefetch_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	} else {
+		prefetch_count = prefetch_setting.GetValue<uint64_t>();
+	}
 
+	//! Load the snapshot
 	vector<IcebergManifest> all_manifests;
-	while (!manifest_list->Finished()) {
-		manifest_list->Read(STANDARD_VECTOR_SIZE, all_manifests);
+	if (parent_manifests) {
+		//! The manifests that passed the filters of the list we were pushed down from, our filters are stricter
+		all_manifests = *parent_manifests;
+		parent_manifests = nullptr;
+	} else {
+		// Read the manifest list, we need all the manifests to determine if we've seen all deletes
+		all_manifests = ReadManifestList();
 	}
 
 	for (auto &manifest : all_manifests) {
@@ -509,7 +699,9 @@ void IcebergMultiFileList::InitializeFiles(lock_guard<mutex> &guard) {
 	}
 
 	current_data_manifest = data_manifests.begin();
-	current_delete_manifest = delete_manifests.begin();
+	if (delete_manifests.empty()) {
+		deletes_loaded = true;
+	}
 }
 
 void IcebergMultiFileList::ProcessDeletes(const vector<MultiFileColumnDefinition> &global_columns) const {
@@ -518,54 +710,230 @@ void IcebergMultiFileList::ProcessDeletes(const vector<MultiFileColumnDefinition
 
 	// v3 solves this, `referenced_data_file` will tell us which file the `data_file`
 	// is targeting before we open it, and there can only be one deletion vector per data file.
+	// The deletion vectors are only indexed here, they're read by GetDeletionVectorForFile/ReadDeletionVector
 
 	// From the spec: "At most one deletion vector is allowed per data file in a snapshot"
 
-	auto iceberg_path = GetPath();
-	auto &fs = FileSystem::GetFileSystem(context);
-
-	vector<IcebergManifestEntry> delete_files;
-	while (current_delete_manifest != delete_manifests.end()) {
-		if (delete_manifest_reader->Finished()) {
-			if (current_delete_manifest == delete_manifests.end()) {
-				break;
+	if (deletes_loaded) {
+		return;
+	}
+	{
+		unique_lock<mutex> guard(delete_lock);
+		if (deletes_loaded) {
+			return;
+		}
+		if (delete_executor) {
+			//! Another scan owns the load, wait for it to finish instead of spinning on the executor
+			deletes_finished.wait(guard, [&]() { return deletes_loaded || delete_error.HasError(); });
+			if (delete_error.HasError()) {
+				delete_error.Throw();
 			}
-			auto &manifest = *current_delete_manifest;
-			auto manifest_entry_full_path = options.allow_moved_paths
-			                                    ? IcebergUtils::GetFullPath(iceberg_path, manifest.manifest_path, fs)
-			                                    : manifest.manifest_path;
-			auto scan = make_uniq<AvroScan>("IcebergManifest", context, manifest_entry_full_path);
-			delete_manifest_reader->Initialize(std::move(scan));
-			delete_manifest_reader->SetSequenceNumber(manifest.sequence_number);
-			delete_manifest_reader->SetPartitionSpecID(manifest.partition_spec_id);
-		}
-
-		delete_manifest_reader->Read(STANDARD_VECTOR_SIZE, delete_files);
-		if (delete_manifest_reader->Finished()) {
-			current_delete_manifest++;
-			continue;
+			return;
 		}
+		//! The manifest reads schedule the scans of their delete files on the same executor
+		delete_executor = make_uniq<TaskExecutor>(context);
+		shared_ptr<const vector<MultiFileColumnDefinition>> columns =
+		    make_shared_ptr<vector<MultiFileColumnDefinition>>(global_columns);
+		for (auto &manifest : delete_manifests) {
+			delete_executor->ScheduleTask(
+			    make_uniq<IcebergDeleteManifestReadTask>(*delete_executor, *this, manifest, columns));
+		}
+	}
+	//! This scan owns the load, it works on the tasks together with the TaskScheduler until all of them finished
+	ErrorData error;
+	try {
+		delete_executor->WorkOnTasks();
+	} catch (std::exception &ex) {
+		error = ErrorData(ex);
 	}
+	{
+		lock_guard<mutex> guard(delete_lock);
+		if (error.HasError()) {
+			delete_error = error;
+		} else {
+			SortRangedPositionalDeletes();
+			deletes_loaded = true;
+		}
+	}
+	deletes_finished.notify_all();
+	if (error.HasError()) {
+		error.Throw();
+	}
+}
 
-#ifdef DEBUG
-	for (auto &entry : data_files) {
-		D_ASSERT(entry.content == IcebergManifestEntryContentType::DATA);
-		D_ASSERT(entry.status != IcebergManifestEntryStatusType::DELETED);
+void IcebergMultiFileList::ReadDeleteManifest(TaskExecutor &executor, const IcebergManifest &manifest,
+                                              shared_ptr<const vector<MultiFileColumnDefinition>> global_columns) const {
+	auto iceberg_path = GetPath();
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto manifest_entry_full_path = options.allow_moved_paths
+	                                    ? IcebergUtils::GetFullPath(iceberg_path, manifest.manifest_path, fs)
+	                                    : manifest.manifest_path;
+
+	auto memory_limit = IcebergManifestCache::GetMemoryLimit(context);
+	shared_ptr<IcebergCachedManifest> cached;
+	if (memory_limit != 0) {
+		cached = IcebergManifestCache::Get(context).Get(manifest_entry_full_path);
+	}
+	if (!cached) {
+		ManifestFileReader manifest_reader(GetMetadata().iceberg_version);
+		//! Only the bounds of the 'file_path' column of positional deletes are used
+		manifest_reader.metrics_field_ids.insert(POSITIONAL_DELETE_FILE_PATH_FIELD_ID);
+		manifest_reader.Initialize(
+		    make_uniq<AvroScan>("IcebergManifest", context, manifest_entry_full_path, manifest.manifest_length));
+		manifest_reader.SetSequenceNumber(manifest.sequence_number);
+		manifest_reader.SetPartitionSpecID(manifest.partition_spec_id);
+
+		cached = make_shared_ptr<IcebergCachedManifest>();
+		while (!manifest_reader.Finished()) {
+			manifest_reader.Read(STANDARD_VECTOR_SIZE, cached->delete_files);
+		}
+		if (memory_limit != 0) {
+			IcebergManifestCache::Get(context).Put(manifest_entry_full_path, cached, memory_limit);
+		}
 	}
-#endif
+	//! The entries are moved into the delete data of this list, the cached ones are left untouched
+	auto delete_files = cached->delete_files;
 
 	for (auto &entry : delete_files) {
+		if (StringUtil::CIEquals(entry.file_format, "puffin")) {
+			if (entry.content != IcebergManifestEntryContentType::POSITION_DELETES ||
+			    entry.referenced_data_file.empty()) {
+				throw InvalidInputException("Puffin delete file '%s' is not a deletion vector", entry.file_path);
+			}
+			//! Deletion vectors are only read once the data file they reference is scanned
+			lock_guard<mutex> guard(delete_lock);
+			auto referenced_data_file = entry.referenced_data_file;
+			deletion_vectors[referenced_data_file] = std::move(entry);
+			continue;
+		}
 		if (!StringUtil::CIEquals(entry.file_format, "parquet")) {
 			throw NotImplementedException(
 			    "File format '%s' not supported for deletes, only supports 'parquet' currently", entry.file_format);
 		}
-		ScanDeleteFile(entry, global_columns);
+		if (entry.content == IcebergManifestEntryContentType::POSITION_DELETES && IndexPositionalDeleteFile(entry)) {
+			continue;
+		}
+		executor.ScheduleTask(
+		    make_uniq<IcebergDeleteFileScanTask>(executor, *this, std::move(entry), global_columns));
+	}
+}
+
+static bool TryGetFilePathBound(const unordered_map<int32_t, Value> &bounds, string &result) {
+	auto it = bounds.find(POSITIONAL_DELETE_FILE_PATH_FIELD_ID);
+	if (it == bounds.end() || it->second.IsNull()) {
+		return false;
+	}
+	result = StringValue::Get(it->second);
+	return true;
+}
+
+bool IcebergMultiFileList::IndexPositionalDeleteFile(IcebergManifestEntry &entry) const {
+	string lower_bound;
+	string upper_bound;
+	if (!entry.referenced_data_file.empty()) {
+		lower_bound = entry.referenced_data_file;
+		upper_bound = entry.referenced_data_file;
+	} else if (!TryGetFilePathBound(entry.lower_bounds, lower_bound) ||
+	           !TryGetFilePathBound(entry.upper_bounds, upper_bound)) {
+		//! The deletes could apply to any data file
+		return false;
+	}
+	const bool single_file = lower_bound == upper_bound;
+
+	lock_guard<mutex> guard(delete_lock);
+	auto file_idx = positional_delete_files.size();
+	if (single_file) {
+		single_file_positional_deletes[lower_bound].push_back(file_idx);
+	} else {
+		ranged_positional_deletes.push_back(file_idx);
+	}
+	positional_delete_files.push_back(
+	    make_uniq<IcebergPositionalDeleteFile>(std::move(entry), std::move(lower_bound), std::move(upper_bound)));
+	return true;
+}
+
+void IcebergMultiFileList::SortRangedPositionalDeletes() const {
+	//! The bounds are compared bytewise, like the (UTF-8) bounds in the metrics
+	std::sort(ranged_positional_deletes.begin(), ranged_positional_deletes.end(), [&](idx_t a, idx_t b) {
+		return positional_delete_files[a]->lower_bound < positional_delete_files[b]->lower_bound;
+	});
+	ranged_positional_deletes_max_upper.clear();
+	ranged_positional_deletes_max_upper.reserve(ranged_positional_deletes.size());
+	for (auto file_idx : ranged_positional_deletes) {
+		auto &upper_bound = positional_delete_files[file_idx]->upper_bound;
+		if (ranged_positional_deletes_max_upper.empty() || upper_bound > ranged_positional_deletes_max_upper.back()) {
+			ranged_positional_deletes_max_upper.push_back(upper_bound);
+		} else {
+			ranged_positional_deletes_max_upper.push_back(ranged_positional_deletes_max_upper.back());
+		}
+	}
+}
+
+void IcebergMultiFileList::LoadPositionalDeletesForFile(const string &file_path,
+                                                        const vector<MultiFileColumnDefinition> &global_columns) const {
+	D_ASSERT(deletes_loaded);
+	//! The index is complete once the deletes are loaded, it no longer changes
+	vector<reference<IcebergPositionalDeleteFile>> delete_files;
+	auto single_file_it = single_file_positional_deletes.find(file_path);
+	if (single_file_it != single_file_positional_deletes.end()) {
+		for (auto file_idx : single_file_it->second) {
+			delete_files.push_back(*positional_delete_files[file_idx]);
+		}
+	}
+	//! Only the files with a lower bound <= 'file_path' can contain it, of those we walk back from the highest lower
+	//! bound until none of the remaining files has an upper bound >= 'file_path'
+	auto ranged_end = std::upper_bound(
+	    ranged_positional_deletes.begin(), ranged_positional_deletes.end(), file_path,
+	    [&](const string &path, idx_t file_idx) { return path < positional_delete_files[file_idx]->lower_bound; });
+	for (auto i = NumericCast<idx_t>(ranged_end - ranged_positional_deletes.begin()); i > 0; i--) {
+		if (ranged_positional_deletes_max_upper[i - 1] < file_path) {
+			break;
+		}
+		auto &delete_file = *positional_delete_files[ranged_positional_deletes[i - 1]];
+		if (delete_file.upper_bound >= file_path) {
+			delete_files.push_back(delete_file);
+		}
 	}
 
-	D_ASSERT(current_delete_manifest == delete_manifests.end());
+	for (auto &delete_file_ref : delete_files) {
+		auto &delete_file = delete_file_ref.get();
+		//! Another data file within the bounds can be scanning the file, wait for it instead of scanning it again
+		lock_guard<mutex> guard(delete_file.lock);
+		if (delete_file.loaded) {
+			continue;
+		}
+		DUCKDB_LOG(context, IcebergLogType, "Iceberg Delete Pushdown, scanned 'delete_file': '%s'",
+		           delete_file.entry.file_path);
+		ScanDeleteFile(delete_file.entry, global_columns);
+		delete_file.loaded = true;
+	}
+}
+
+IcebergDeleteManifestReadTask::IcebergDeleteManifestReadTask(
+    TaskExecutor &executor, const IcebergMultiFileList &multi_file_list, const IcebergManifest &manifest,
+    shared_ptr<const vector<MultiFileColumnDefinition>> global_columns)
+    : BaseExecutorTask(executor), multi_file_list(multi_file_list), manifest(manifest),
+      global_columns(std::move(global_columns)) {
+}
+
+void IcebergDeleteManifestReadTask::ExecuteTask() {
+	multi_file_list.ReadDeleteManifest(executor, manifest, global_columns);
 }
 
-void IcebergMultiFileList::ScanPositionalDeleteFile(DataChunk &result) const {
+IcebergDeleteFileScanTask::IcebergDeleteFileScanTask(TaskExecutor &executor,
+                                                     const IcebergMultiFileList &multi_file_list,
+                                                     IcebergManifestEntry entry_p,
+                                                     shared_ptr<const vector<MultiFileColumnDefinition>> global_columns)
+    : BaseExecutorTask(executor), multi_file_list(multi_file_list), entry(std::move(entry_p)),
+      global_columns(std::move(global_columns)) {
+}
+
+void IcebergDeleteFileScanTask::ExecuteTask() {
+	multi_file_list.ScanDeleteFile(entry, *global_columns);
+}
+
+void IcebergMultiFileList::ScanPositionalDeleteFile(
+    DataChunk &result, case_insensitive_map_t<unique_ptr<IcebergPositionalDeleteData>> &positional_delete_data) const {
 	//! FIXME: might want to check the 'columns' of the 'reader' to check, field-ids are:
 	auto names = FlatVector::GetData<string_t>(result.data[0]);  //! 2147483546
 	auto row_ids = FlatVector::GetData<int64_t>(result.data[1]); //! 2147483545
@@ -601,26 +969,153 @@ void IcebergMultiFileList::ScanPositionalDeleteFile(DataChunk &result) const {
 	}
 }
 
-static void InitializeFromOtherChunk(DataChunk &target, DataChunk &other, const vector<column_t> &column_ids) {
-	vector<LogicalType> types;
-	for (auto &id : column_ids) {
-		types.push_back(other.data[id].GetType());
+void IcebergEqualityDeleteFile::HashKeys(vector<Vector> &keys, idx_t count, Vector &hashes) {
+	D_ASSERT(!keys.empty());
+	VectorOperations::Hash(keys[0], hashes, count);
+	for (idx_t i = 1; i < keys.size(); i++) {
+		VectorOperations::CombineHash(hashes, keys[i], count);
+	}
+	hashes.Flatten(count);
+}
+
+void IcebergEqualityDeleteFile::Append(Allocator &allocator, vector<Vector> &key_columns, idx_t count,
+                                       Vector &hashes) {
+	D_ASSERT(key_columns.size() == equality_ids.size());
+	if (!collection) {
+		vector<LogicalType> types;
+		for (auto &key : key_columns) {
+			types.push_back(key.GetType());
+		}
+		collection = make_uniq<ColumnDataCollection>(allocator, std::move(types));
+	}
+	DataChunk chunk;
+	chunk.InitializeEmpty(collection->Types());
+	for (idx_t col_idx = 0; col_idx < key_columns.size(); col_idx++) {
+		chunk.data[col_idx].Reference(key_columns[col_idx]);
+	}
+	chunk.SetCardinality(count);
+	collection->Append(chunk);
+
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < count; i++) {
+		auto row_idx = row_count + i;
+		auto entry = hash_to_row.emplace(hash_data[i], row_idx);
+		if (entry.second) {
+			next_row.push_back(DConstants::INVALID_INDEX);
+		} else {
+			next_row.push_back(entry.first->second);
+			entry.first->second = row_idx;
+		}
+	}
+	row_count += count;
+}
+
+void IcebergEqualityDeleteFile::Finalize() {
+	if (!collection) {
+		return;
+	}
+	//! One vector per column for all the deleted rows, so a delete is addressed by its row index
+	for (auto &type : collection->Types()) {
+		keys.emplace_back(type, MaxValue<idx_t>(row_count, 1));
+	}
+	idx_t offset = 0;
+	for (auto &chunk : collection->Chunks()) {
+		for (idx_t col_idx = 0; col_idx < keys.size(); col_idx++) {
+			VectorOperations::Copy(chunk.data[col_idx], keys[col_idx], chunk.size(), 0, offset);
+		}
+		offset += chunk.size();
+	}
+	D_ASSERT(offset == row_count);
+	collection.reset();
+}
+
+idx_t IcebergEqualityDeleteFile::Filter(vector<Vector> &key_columns, const hash_t *hashes, SelectionVector &sel,
+                                        idx_t count) const {
+	D_ASSERT(key_columns.size() == keys.size());
+	//! Pair every row with the last added delete of the same hash, the other deletes of the hash are chained
+	SelectionVector probe_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector build_sel(STANDARD_VECTOR_SIZE);
+	idx_t candidate_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto row_idx = sel.get_index(i);
+		auto entry = hash_to_row.find(hashes[row_idx]);
+		if (entry == hash_to_row.end()) {
+			continue;
+		}
+		probe_sel.set_index(candidate_count, row_idx);
+		build_sel.set_index(candidate_count, entry->second);
+		candidate_count++;
+	}
+	if (candidate_count == 0) {
+		return count;
+	}
+
+	vector<bool> deleted(STANDARD_VECTOR_SIZE, false);
+	SelectionVector match_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector column_match_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector no_match_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector next_probe_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector next_build_sel(STANDARD_VECTOR_SIZE);
+	while (candidate_count > 0) {
+		//! Compare the pairs one column at a time, only the pairs that matched so far are compared on the next column
+		//! NOTE: NULL deletes NULL
+		idx_t match_count = candidate_count;
+		idx_t no_match_count = 0;
+		for (idx_t col_idx = 0; col_idx < keys.size() && match_count > 0; col_idx++) {
+			Vector probe(key_columns[col_idx], probe_sel, candidate_count);
+			Vector build(keys[col_idx], build_sel, candidate_count);
+			SelectionVector column_no_match_sel(no_match_sel.data() + no_match_count);
+			auto column_match_count =
+			    VectorOperations::NotDistinctFrom(probe, build, col_idx == 0 ? nullptr : &match_sel, match_count,
+			                                      &column_match_sel, &column_no_match_sel);
+			no_match_count += match_count - column_match_count;
+			match_count = column_match_count;
+			std::swap(match_sel, column_match_sel);
+		}
+		for (idx_t i = 0; i < match_count; i++) {
+			deleted[probe_sel.get_index(match_sel.get_index(i))] = true;
+		}
+
+		//! The pairs that did not match are compared to the next delete of the hash
+		idx_t next_count = 0;
+		for (idx_t i = 0; i < no_match_count; i++) {
+			auto pair_idx = no_match_sel.get_index(i);
+			auto next = next_row[build_sel.get_index(pair_idx)];
+			if (next == DConstants::INVALID_INDEX) {
+				continue;
+			}
+			next_probe_sel.set_index(next_count, probe_sel.get_index(pair_idx));
+			next_build_sel.set_index(next_count, next);
+			next_count++;
+		}
+		std::swap(probe_sel, next_probe_sel);
+		std::swap(build_sel, next_build_sel);
+		candidate_count = next_count;
+	}
+
+	idx_t remaining = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto row_idx = sel.get_index(i);
+		if (!deleted[row_idx]) {
+			sel.set_index(remaining++, row_idx);
+		}
 	}
-	target.InitializeEmpty(types);
+	return remaining;
 }
 
-void IcebergMultiFileList::ScanEqualityDeleteFile(const IcebergManifestEntry &entry, DataChunk &result_p,
+void IcebergMultiFileList::ScanEqualityDeleteFile(const IcebergManifestEntry &entry, DataChunk &result,
                                                   vector<MultiFileColumnDefinition> &local_columns,
-                                                  const vector<MultiFileColumnDefinition> &global_columns) const {
+                                                  const vector<MultiFileColumnDefinition> &global_columns,
+                                                  IcebergEqualityDeleteFile &delete_file) const {
 	D_ASSERT(!entry.equality_ids.empty());
-	D_ASSERT(result_p.ColumnCount() == local_columns.size());
+	D_ASSERT(result.ColumnCount() == local_columns.size());
 
-	auto count = result_p.size();
+	auto count = result.size();
 	if (count == 0) {
 		return;
 	}
 
-	//! Map from column_id to 'local_columns' index, to figure out which columns from the 'result_p' are relevant here
+	//! Map from column_id to 'local_columns' index, to figure out which columns from the 'result' are relevant here
 	unordered_map<int32_t, column_t> id_to_column;
 	for (column_t i = 0; i < local_columns.size(); i++) {
 		auto &col = local_columns[i];
@@ -628,23 +1123,7 @@ void IcebergMultiFileList::ScanEqualityDeleteFile(const IcebergManifestEntry &en
 		id_to_column[col.identifier.GetValue<int32_t>()] = i;
 	}
 
-	vector<column_t> column_ids;
-	DataChunk result;
-	for (auto id : entry.equality_ids) {
-		D_ASSERT(id_to_column.count(id));
-		column_ids.push_back(id_to_column[id]);
-	}
-
-	//! Get or create the equality delete data for this sequence number
-	auto it = equality_delete_data.find(entry.sequence_number);
-	if (it == equality_delete_data.end()) {
-		it = equality_delete_data
-		         .emplace(entry.sequence_number, make_uniq<IcebergEqualityDeleteData>(entry.sequence_number))
-		         .first;
-	}
-	auto &deletes = *it->second;
-
-	//! Map from column_id to 'global_columns' index, so we can create a reference to the correct global index
+	//! Map from column_id to 'global_columns' index, the scanned chunks are probed on the global columns
 	unordered_map<int32_t, column_t> id_to_global_column;
 	for (column_t i = 0; i < global_columns.size(); i++) {
 		auto &col = global_columns[i];
@@ -652,39 +1131,32 @@ void IcebergMultiFileList::ScanEqualityDeleteFile(const IcebergManifestEntry &en
 		id_to_global_column[col.identifier.GetValue<int32_t>()] = i;
 	}
 
-	//! Take only the relevant columns from the result
-	InitializeFromOtherChunk(result, result_p, column_ids);
-	result.ReferenceColumns(result_p, column_ids);
-	deletes.files.emplace_back(entry.partition, entry.partition_spec_id);
-	auto &rows = deletes.files.back().rows;
-	rows.resize(count);
-	D_ASSERT(result.ColumnCount() == entry.equality_ids.size());
-	for (idx_t col_idx = 0; col_idx < result.ColumnCount(); col_idx++) {
-		auto &field_id = entry.equality_ids[col_idx];
-		auto global_column_id = id_to_global_column[field_id];
-		auto &col = global_columns[global_column_id];
-		auto &vec = result.data[col_idx];
-
-		for (idx_t i = 0; i < count; i++) {
-			auto &row = rows[i];
-			auto constant = vec.GetValue(i);
-			unique_ptr<Expression> equality_filter;
-			auto bound_ref = make_uniq<BoundReferenceExpression>(col.type, global_column_id);
-			if (!constant.IsNull()) {
-				//! Create a COMPARE_NOT_EQUAL expression
-				equality_filter =
-				    make_uniq<BoundComparisonExpression>(ExpressionType::COMPARE_NOTEQUAL, std::move(bound_ref),
-				                                         make_uniq<BoundConstantExpression>(constant));
-			} else {
-				//! Construct an OPERATOR_IS_NOT_NULL expression instead
-				auto is_not_null =
-				    make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_IS_NOT_NULL, LogicalType::BOOLEAN);
-				is_not_null->children.push_back(std::move(bound_ref));
-				equality_filter = std::move(is_not_null);
-			}
-			row.filters.emplace(std::make_pair(field_id, std::move(equality_filter)));
+	if (delete_file.column_indexes.empty()) {
+		for (auto id : entry.equality_ids) {
+			D_ASSERT(id_to_global_column.count(id));
+			delete_file.column_indexes.push_back(id_to_global_column[id]);
 		}
 	}
+
+	//! Take the equality columns from the result, with the type of the column in the table
+	vector<Vector> keys;
+	keys.reserve(entry.equality_ids.size());
+	for (idx_t col_idx = 0; col_idx < entry.equality_ids.size(); col_idx++) {
+		auto field_id = entry.equality_ids[col_idx];
+		D_ASSERT(id_to_column.count(field_id));
+		auto &vec = result.data[id_to_column[field_id]];
+		auto &type = global_columns[delete_file.column_indexes[col_idx]].type;
+		if (vec.GetType() == type) {
+			keys.emplace_back(vec);
+		} else {
+			keys.emplace_back(type, count);
+			VectorOperations::DefaultCast(vec, keys.back(), count);
+		}
+	}
+
+	Vector hashes(LogicalType::HASH, count);
+	IcebergEqualityDeleteFile::HashKeys(keys, count, hashes);
+	delete_file.Append(Allocator::Get(context), keys, count, hashes);
 }
 
 void IcebergMultiFileList::ScanDeleteFile(const IcebergManifestEntry &entry,
@@ -731,22 +1203,46 @@ void IcebergMultiFileList::ScanDeleteFile(const IcebergManifestEntry &entry,
 
 	auto &multi_file_local_state = local_state->Cast<MultiFileLocalState>();
 
+	//! The deletes of the file are collected first, then merged into the delete data of the list in one go
 	if (entry.content == IcebergManifestEntryContentType::POSITION_DELETES) {
+		case_insensitive_map_t<unique_ptr<IcebergPositionalDeleteData>> file_deletes;
 		do {
 			TableFunctionInput function_input(bind_data.get(), local_state.get(), global_state.get());
 			result.Reset();
 			parquet_scan.function(context, function_input, result);
 			result.Flatten();
-			ScanPositionalDeleteFile(result);
+			ScanPositionalDeleteFile(result, file_deletes);
 		} while (result.size() != 0);
+
+		lock_guard<mutex> guard(delete_lock);
+		for (auto &file_delete : file_deletes) {
+			auto &deletes = positional_delete_data[file_delete.first];
+			if (!deletes) {
+				deletes = std::move(file_delete.second);
+			} else {
+				deletes->deleted_rows.Merge(file_delete.second->deleted_rows);
+			}
+		}
 	} else if (entry.content == IcebergManifestEntryContentType::EQUALITY_DELETES) {
+		IcebergEqualityDeleteFile delete_file(entry.sequence_number, entry.partition, entry.partition_spec_id,
+		                                      entry.equality_ids);
 		do {
 			TableFunctionInput function_input(bind_data.get(), local_state.get(), global_state.get());
 			result.Reset();
 			parquet_scan.function(context, function_input, result);
 			result.Flatten();
-			ScanEqualityDeleteFile(entry, result, multi_file_local_state.reader->columns, global_columns);
+			ScanEqualityDeleteFile(entry, result, multi_file_local_state.reader->columns, global_columns, delete_file);
 		} while (result.size() != 0);
+		delete_file.Finalize();
+
+		lock_guard<mutex> guard(delete_lock);
+		auto &partition_spec = GetMetadata().partition_specs.at(entry.partition_spec_id);
+		if (!partition_spec.IsPartitioned()) {
+			unpartitioned_equality_deletes.files.push_back(std::move(delete_file));
+		} else {
+			auto partition_hash = IcebergEqualityDeleteData::GetPartitionHash(entry.partition_spec_id, entry.partition);
+			partitioned_equality_deletes[partition_hash].files.push_back(std::move(delete_file));
+		}
 	}
 }
 
@@ -755,9 +1251,129 @@ IcebergMultiFileList::GetPositionalDeletesForFile(const string &file_path) const
 	auto it = positional_delete_data.find(file_path);
 	if (it != positional_delete_data.end()) {
 		// There is delete data for this file, return it
+		it->second->Finalize();
 		return std::move(it->second);
 	}
 	return nullptr;
 }
 
+unique_ptr<IcebergManifestEntry> IcebergMultiFileList::GetDeletionVectorForFile(const string &file_path) const {
+	auto it = deletion_vectors.find(file_path);
+	if (it == deletion_vectors.end()) {
+		return nullptr;
+	}
+	auto result = make_uniq<IcebergManifestEntry>(std::move(it->second));
+	deletion_vectors.erase(it);
+	return result;
+}
+
+void IcebergMultiFileList::ReadDeletionVector(const IcebergManifestEntry &entry,
+                                              IcebergPositionalDeleteData &deletes) const {
+	if (entry.content_offset < 0 || entry.content_size_in_bytes <= 0) {
+		throw InvalidInputException("Deletion vector for '%s' has an invalid 'content_offset' (%lld) or "
+		                            "'content_size_in_bytes' (%lld)",
+		                            entry.referenced_data_file, entry.content_offset, entry.content_size_in_bytes);
+	}
+	auto offset = NumericCast<idx_t>(entry.content_offset);
+	auto size = NumericCast<idx_t>(entry.content_size_in_bytes);
+
+	//! Only the blob is read from the puffin file, not the footer
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto handle = fs.OpenFile(entry.file_path, FileFlags::FILE_FLAGS_READ);
+	auto blob = make_unsafe_uniq_array<data_t>(size);
+	handle->Read(blob.get(), size, offset);
+
+	deletes.deleted_rows.AddDeletionVector(blob.get(), size);
+	deletes.Finalize();
+}
+
+static void AddEqualityDeleteFiles(IcebergEqualityDeleteFilter &result, const IcebergEqualityDeleteData &delete_data,
+                                   sequence_number_t sequence_number, int32_t partition_spec_id,
+                                   optional_ptr<const Value> partition,
+                                   const unordered_set<int32_t> &local_field_ids) {
+	for (auto &file : delete_data.files) {
+		if (file.sequence_number <= sequence_number || file.row_count == 0) {
+			continue;
+		}
+		if (partition && (file.partition_spec_id != partition_spec_id || file.partition != *partition)) {
+			//! Another partition that happens to have the same hash
+			continue;
+		}
+		IcebergEqualityDeleteFilter::DeleteFile delete_file(file);
+		for (auto field_id : file.equality_ids) {
+			delete_file.column_present.push_back(local_field_ids.count(field_id) != 0);
+		}
+		result.files.push_back(std::move(delete_file));
+	}
+}
+
+unique_ptr<IcebergEqualityDeleteFilter>
+IcebergMultiFileList::GetEqualityDeletesForFile(sequence_number_t sequence_number, int32_t partition_spec_id,
+                                                const Value &partition,
+                                                const vector<MultiFileColumnDefinition> &local_columns) const {
+	//! The deletes of an unpartitioned spec apply to every data file, those of a partitioned spec only to the data
+	//! files of the same spec and partition
+	auto partition_it = partitioned_equality_deletes.end();
+	if (!partitioned_equality_deletes.empty()) {
+		partition_it =
+		    partitioned_equality_deletes.find(IcebergEqualityDeleteData::GetPartitionHash(partition_spec_id, partition));
+	}
+	if (unpartitioned_equality_deletes.files.empty() && partition_it == partitioned_equality_deletes.end()) {
+		return nullptr;
+	}
+	unordered_set<int32_t> local_field_ids;
+	for (auto &col : local_columns) {
+		D_ASSERT(!col.identifier.IsNull());
+		local_field_ids.insert(col.identifier.GetValue<int32_t>());
+	}
+
+	auto result = make_uniq<IcebergEqualityDeleteFilter>();
+	AddEqualityDeleteFiles(*result, unpartitioned_equality_deletes, sequence_number, partition_spec_id, nullptr,
+	                       local_field_ids);
+	if (partition_it != partitioned_equality_deletes.end()) {
+		AddEqualityDeleteFiles(*result, partition_it->second, sequence_number, partition_spec_id, &partition,
+		                       local_field_ids);
+	}
+	if (result->files.empty()) {
+		return nullptr;
+	}
+	return result;
+}
+
+void IcebergEqualityDeleteFilter::Filter(DataChunk &chunk) const {
+	//! Probe the rows that are left on the hashed deletes of every file:
+	//! a row is deleted if all its equality columns are equal to (or both NULL) those of a delete
+	auto chunk_size = chunk.size();
+	SelectionVector sel_vec(STANDARD_VECTOR_SIZE);
+	idx_t count = chunk_size;
+	for (idx_t i = 0; i < count; i++) {
+		sel_vec.set_index(i, i);
+	}
+	Vector hashes(LogicalType::HASH, chunk_size);
+	for (auto &delete_file : files) {
+		auto &file = delete_file.file.get();
+		vector<Vector> keys;
+		keys.reserve(file.equality_ids.size());
+		for (idx_t col_idx = 0; col_idx < file.equality_ids.size(); col_idx++) {
+			auto &vec = chunk.data[file.column_indexes[col_idx]];
+			if (delete_file.column_present[col_idx]) {
+				keys.emplace_back(vec);
+			} else {
+				//! This column is not present in the file
+				//! For the purpose of the equality deletes, we are treating it as if its value is NULL (despite any
+				//! 'initial-default' that exists)
+				keys.emplace_back(Value(vec.GetType()));
+			}
+		}
+		IcebergEqualityDeleteFile::HashKeys(keys, chunk_size, hashes);
+		count = file.Filter(keys, FlatVector::GetData<hash_t>(hashes), sel_vec, count);
+		if (count == 0) {
+			break;
+		}
+	}
+	if (count != chunk_size) {
+		chunk.Slice(sel_vec, count);
+	}
+}
+
 } // namespace duckdb
@@ -64,8 +64,11 @@ bool IcebergMultiFileReader::Bind(MultiFileOptions &options, MultiFileList &file
 
 	auto &schema = iceberg_multi_file_list.GetSchema().columns;
 	auto &columns = bind_data.schema;
-	for (auto &item : schema) {
-		columns.push_back(TransformColumn(*item));
+	D_ASSERT(schema.size() == names.size());
+	for (idx_t i = 0; i < schema.size(); i++) {
+		columns.push_back(TransformColumn(*schema[i]));
+		//! Use the deduplicated name, the columns are mapped by field id
+		columns.back().name = names[i];
 	}
 	bind_data.mapping = MultiFileColumnMappingMode::BY_FIELD_ID;
 	return true;
@@ -174,15 +177,12 @@ static Value TransformPartitionValue(const Value &value, const LogicalType &type
 
 static void ApplyPartitionConstants(const IcebergMultiFileList &multi_file_list, MultiFileReaderData &reader_data,
                                     const vector<MultiFileColumnDefinition> &global_columns,
-                                    const vector<ColumnIndex> &global_column_ids) {
-	// Get the metadata for this file
+                                    const vector<ColumnIndex> &global_column_ids, int32_t spec_id,
+                                    const Value &partition_value) {
 	auto &reader = *reader_data.reader;
-	auto file_id = reader.file_list_idx.GetIndex();
-	auto &data_file = multi_file_list.data_files[file_id];
 
 	// Get the partition spec for this file
 	auto &partition_specs = multi_file_list.GetMetadata().partition_specs;
-	auto spec_id = data_file.partition_spec_id;
 	auto partition_spec_it = partition_specs.find(spec_id);
 	if (partition_spec_it == partition_specs.end()) {
 		throw InvalidConfigurationException("'partition_spec_id' %d doesn't exist in the metadata", spec_id);
@@ -231,7 +231,6 @@ static void ApplyPartitionConstants(const IcebergMultiFileList &multi_file_list,
 		}
 
 		// Get the partition value from the data file's partition struct
-		auto partition_value = data_file.partition;
 		if (partition_value.IsNull()) {
 			continue; // No partition value available
 		}
@@ -263,23 +262,40 @@ void IcebergMultiFileReader::FinalizeBind(MultiFileReaderData &reader_data, cons
 	D_ASSERT(global_state);
 	// Get the metadata for this file
 	const auto &multi_file_list = dynamic_cast<const IcebergMultiFileList &>(*global_state->file_list);
-	{
-		lock_guard<mutex> guard(multi_file_list.lock);
-		D_ASSERT(multi_file_list.initialized);
-	}
 	auto &reader = *reader_data.reader;
 	auto file_id = reader.file_list_idx.GetIndex();
-	const auto &data_file = multi_file_list.data_files[file_id];
 
-	// The path of the data file where this chunk was read from
-	const auto &file_path = data_file.file_path;
+	// The data files can be appended to concurrently, read what we need under the lock
+	string file_path;
+	sequence_number_t sequence_number;
+	int32_t partition_spec_id;
+	Value partition;
 	{
 		lock_guard<mutex> guard(multi_file_list.lock);
-		std::lock_guard<mutex> delete_guard(multi_file_list.delete_lock);
-		if (multi_file_list.current_delete_manifest != multi_file_list.delete_manifests.end()) {
-			multi_file_list.ProcessDeletes(global_columns);
+		D_ASSERT(multi_file_list.initialized);
+		auto &data_files = multi_file_list.data_files;
+		// The path of the data file where this chunk was read from
+		file_path = data_files.GetFilePath(file_id).GetString();
+		sequence_number = data_files.GetSequenceNumber(file_id);
+		partition_spec_id = data_files.GetPartitionSpecID(file_id);
+		partition = data_files.GetPartition(file_id);
+	}
+	//! Returns right away once the deletes are loaded
+	multi_file_list.ProcessDeletes(global_columns);
+	multi_file_list.LoadPositionalDeletesForFile(file_path, global_columns);
+	unique_ptr<IcebergPositionalDeleteData> positional_deletes;
+	unique_ptr<IcebergManifestEntry> deletion_vector;
+	{
+		lock_guard<mutex> delete_guard(multi_file_list.delete_lock);
+		positional_deletes = multi_file_list.GetPositionalDeletesForFile(file_path);
+		deletion_vector = multi_file_list.GetDeletionVectorForFile(file_path);
+	}
+	if (deletion_vector) {
+		//! Read outside of the lock, so the deletion vectors of different data files are read in parallel
+		if (!positional_deletes) {
+			positional_deletes = make_uniq<IcebergPositionalDeleteData>();
 		}
-		reader.deletion_filter = std::move(multi_file_list.GetPositionalDeletesForFile(file_path));
+		multi_file_list.ReadDeletionVector(*deletion_vector, *positional_deletes);
 	}
 
 	auto &local_columns = reader_data.reader->columns;
@@ -291,110 +307,19 @@ void IcebergMultiFileReader::FinalizeBind(MultiFileReaderData &reader_data, cons
 			ApplyFieldMapping(local_column, mappings, root.field_mapping_indexes);
 		}
 	}
-	ApplyPartitionConstants(multi_file_list, reader_data, global_columns, global_column_ids);
-}
-
-void IcebergMultiFileReader::ApplyEqualityDeletes(ClientContext &context, DataChunk &output_chunk,
-                                                  const IcebergMultiFileList &multi_file_list,
-                                                  const IcebergManifestEntry &data_file,
-                                                  const vector<MultiFileColumnDefinition> &local_columns) {
-	vector<reference<IcebergEqualityDeleteRow>> delete_rows;
-
-	auto &metadata = multi_file_list.GetMetadata();
-	auto delete_data_it = multi_file_list.equality_delete_data.upper_bound(data_file.sequence_number);
-	//! Look through all the equality delete files with a *higher* sequence number
-	for (; delete_data_it != multi_file_list.equality_delete_data.end(); delete_data_it++) {
-		auto &files = delete_data_it->second->files;
-		for (auto &file : files) {
-			auto &partition_spec = metadata.partition_specs.at(file.partition_spec_id);
-			if (partition_spec.IsPartitioned()) {
-				if (file.partition_spec_id != data_file.partition_spec_id) {
-					//! Not unpartitioned and the data does not share the same partition spec as the delete, skip the
-					//! delete file.
-					continue;
-				}
-				if (file.partition != data_file.partition) {
-					//! Same partition spec id, but the partitioning information doesn't match, delete file doesn't
-					//! apply.
-					continue;
-				}
-			}
-			delete_rows.insert(delete_rows.end(), file.rows.begin(), file.rows.end());
-		}
-	}
-
-	if (delete_rows.empty()) {
-		return;
-	}
 
-	//! Map from column_id to 'local_columns' index
-	unordered_map<int32_t, column_t> id_to_local_column;
-	for (column_t i = 0; i < local_columns.size(); i++) {
-		auto &col = local_columns[i];
-		D_ASSERT(!col.identifier.IsNull());
-		id_to_local_column[col.identifier.GetValue<int32_t>()] = i;
-	}
-
-	//! Create a big CONJUNCTION_AND of all the rows, illustrative example:
-	//! WHERE
-	//!	(col1 != 'A' OR col2 != 'B') AND
-	//!	(col1 != 'C' OR col2 != 'D') AND
-	//!	(col1 != 'X' OR col2 != 'Y') AND
-	//!	(col1 != 'Z' OR col2 != 'W')
-
-	vector<unique_ptr<Expression>> rows;
-	for (auto &row : delete_rows) {
-		vector<unique_ptr<Expression>> equalities;
-		for (auto &item : row.get().filters) {
-			auto &field_id = item.first;
-			auto &expression = item.second;
-
-			bool treat_as_null = !id_to_local_column.count(field_id);
-			if (treat_as_null) {
-				//! This column is not present in the file
-				//! For the purpose of the equality deletes, we are treating it as if its value is NULL (despite any
-				//! 'initial-default' that exists)
-
-				//! This means that if the expression is 'IS_NOT_NULL', the result is False for this column, otherwise
-				//! it's True (because nothing compares equal to NULL)
-				if (expression->type == ExpressionType::OPERATOR_IS_NOT_NULL) {
-					equalities.push_back(make_uniq<BoundConstantExpression>(Value::BOOLEAN(false)));
-				} else {
-					equalities.push_back(make_uniq<BoundConstantExpression>(Value::BOOLEAN(true)));
-				}
-			} else {
-				equalities.push_back(expression->Copy());
-			}
-		}
-
-		unique_ptr<Expression> filter;
-		D_ASSERT(!equalities.empty());
-		if (equalities.size() > 1) {
-			auto conjunction_or = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_OR);
-			conjunction_or->children = std::move(equalities);
-			filter = std::move(conjunction_or);
-		} else {
-			filter = std::move(equalities[0]);
-		}
-		rows.push_back(std::move(filter));
-	}
-
-	unique_ptr<Expression> equality_delete_filter;
-	D_ASSERT(!rows.empty());
-	if (rows.size() == 1) {
-		equality_delete_filter = std::move(rows[0]);
+	//! The equality deletes are resolved against the (mapped) columns of the file once, the chunks are only probed
+	auto equality_deletes =
+	    multi_file_list.GetEqualityDeletesForFile(sequence_number, partition_spec_id, partition, local_columns);
+	if (equality_deletes) {
+		//! Kept with the reader, so FinalizeChunk finds them without a lookup
+		reader.deletion_filter =
+		    make_uniq<IcebergDeleteFilter>(std::move(positional_deletes), std::move(equality_deletes));
 	} else {
-		auto conjunction_and = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND);
-		conjunction_and->children = std::move(rows);
-		equality_delete_filter = std::move(conjunction_and);
+		reader.deletion_filter = std::move(positional_deletes);
 	}
-
-	//! Apply equality deletes
-	ExpressionExecutor expression_executor(context);
-	expression_executor.AddExpression(*equality_delete_filter);
-	SelectionVector sel_vec(STANDARD_VECTOR_SIZE);
-	idx_t count = expression_executor.SelectExpression(output_chunk, sel_vec);
-	output_chunk.Slice(sel_vec, count);
+	ApplyPartitionConstants(multi_file_list, reader_data, global_columns, global_column_ids, partition_spec_id,
+	                        partition);
 }
 
 void IcebergMultiFileReader::FinalizeChunk(ClientContext &context, const MultiFileBindData &bind_data,
@@ -406,15 +331,11 @@ void IcebergMultiFileReader::FinalizeChunk(ClientContext &context, const MultiFi
 	MultiFileReader::FinalizeChunk(context, bind_data, reader, reader_data, input_chunk, output_chunk, executor,
 	                               global_state);
 
-	D_ASSERT(global_state);
-	// Get the metadata for this file
-	const auto &multi_file_list = dynamic_cast<const IcebergMultiFileList &>(*global_state->file_list);
-	auto file_id = reader.file_list_idx.GetIndex();
-	auto &data_file = multi_file_list.data_files[file_id];
-
-	auto &local_columns = reader.columns;
-
-	ApplyEqualityDeletes(context, output_chunk, multi_file_list, data_file, local_columns);
+	//! The equality deletes of the file were resolved in FinalizeBind, into the deletion filter of the reader
+	auto delete_filter = dynamic_cast<IcebergDeleteFilter *>(reader.deletion_filter.get());
+	if (delete_filter) {
+		delete_filter->equality_deletes->Filter(output_chunk);
+	}
 }
 
 bool IcebergMultiFileReader::ParseOption(const string &key, const Value &val, MultiFileOptions &options,
@@ -23,6 +23,7 @@
 #include "iceberg_metadata.hpp"
 #include "iceberg_utils.hpp"
 #include "iceberg_multi_file_reader.hpp"
+#include "iceberg_multi_file_list.hpp"
 #include "iceberg_functions.hpp"
 #include "storage/irc_table_entry.hpp"
 
@@ -31,6 +32,13 @@
 
 namespace duckdb {
 
+static unique_ptr<BaseStatistics> IcebergScanStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                                        column_t column_index) {
+	auto &bind_data = bind_data_p->Cast<MultiFileBindData>();
+	auto &file_list = dynamic_cast<IcebergMultiFileList &>(*bind_data.file_list);
+	return file_list.GetStatistics(column_index);
+}
+
 static void AddNamedParameters(TableFunction &fun) {
 	fun.named_parameters["allow_moved_paths"] = LogicalType::BOOLEAN;
 	fun.named_parameters["mode"] = LogicalType::VARCHAR;
@@ -51,12 +59,13 @@ TableFunctionSet IcebergFunctions::GetIcebergScanFunction(DatabaseInstance &inst
 	for (auto &function : parquet_scan_copy.functions) {
 		// Register the MultiFileReader as the driver for reads
 		function.get_multi_file_reader = IcebergMultiFileReader::CreateInstance;
+		//! The column statistics come from the metrics in the manifests
+		function.statistics = IcebergScanStatistics;
 
 		// Unset all of these: they are either broken, very inefficient.
 		// TODO: implement/fix these
 		function.serialize = nullptr;
 		function.deserialize = nullptr;
-		function.statistics = nullptr;
 		function.table_scan_progress = nullptr;
 		function.get_bind_info = nullptr;
 
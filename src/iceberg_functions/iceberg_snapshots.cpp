@@ -27,16 +27,15 @@ public:
 
 		auto iceberg_meta_path =
 		    IcebergTableMetadata::GetMetaDataPath(context, bind_data.filename, fs, bind_data.options);
-		auto table_metadata =
-		    IcebergTableMetadata::Parse(iceberg_meta_path, fs, bind_data.options.metadata_compression_codec);
-		global_state->metadata = IcebergTableMetadata::FromTableMetadata(table_metadata);
+		global_state->metadata = IcebergTableMetadata::Load(context, iceberg_meta_path, fs,
+		                                                    bind_data.options.metadata_compression_codec);
 
-		auto &info = global_state->metadata;
+		auto &info = *global_state->metadata;
 		global_state->snapshot_it = info.snapshots.begin();
 		return std::move(global_state);
 	}
 
-	IcebergTableMetadata metadata;
+	shared_ptr<IcebergTableMetadata> metadata;
 	unordered_map<int64_t, IcebergSnapshot>::iterator snapshot_it;
 };
 
@@ -85,7 +84,7 @@ static void IcebergSnapshotsFunction(ClientContext &context, TableFunctionInput
 	auto &bind_data = data.bind_data->Cast<IcebergSnaphotsBindData>();
 	idx_t i = 0;
 	auto &it = global_state.snapshot_it;
-	auto end = global_state.metadata.snapshots.end();
+	auto end = global_state.metadata->snapshots.end();
 	for (; it != end; it++) {
 		if (i >= STANDARD_VECTOR_SIZE) {
 			break;
@@ -9,14 +9,49 @@
 
 namespace duckdb {
 
-AvroScan::AvroScan(const string &scan_name, ClientContext &context, const string &path) : context(context) {
+AvroScan::AvroScan(const string &scan_name, ClientContext &context, const string &path, idx_t file_size)
+    : context(context), scan_name(scan_name), path(path), file_size(file_size) {
 	auto &instance = DatabaseInstance::GetDatabase(context);
 	ExtensionHelper::AutoLoadExtension(instance, "avro");
 
 	auto &avro_scan_entry = ExtensionUtil::GetTableFunction(instance, "read_avro");
+	//! Take a copy of the function, manifests can be read from multiple threads at the same time
 	avro_scan = avro_scan_entry.functions.functions[0];
-	avro_scan->get_multi_file_reader = IcebergAvroMultiFileReader::CreateInstance;
+	avro_scan.get_multi_file_reader = IcebergAvroMultiFileReader::CreateInstance;
 
+	if (file_size != 0) {
+		//! The disk cache is keyed by path + size, only manifests with a known size can be cached on disk
+		disk_cache = IcebergManifestDiskCache::TryGet(context);
+	}
+	if (disk_cache) {
+		buffer_limit = IcebergManifestDiskCache::GetDiskQuota(context);
+	}
+
+	auto cached_schema = LookupCache(path);
+	if (cached_schema) {
+		//! The file is only opened if the scanned columns aren't cached either
+		return_types = cached_schema->types;
+		return_names = cached_schema->names;
+		return;
+	}
+	Bind();
+	StoreCache(path, make_shared_ptr<IcebergCachedAvroFile>(return_types, return_names));
+}
+
+shared_ptr<IcebergCachedAvroFile> AvroScan::LookupCache(const string &key) {
+	if (!disk_cache) {
+		return nullptr;
+	}
+	return disk_cache->Read(context, key, file_size);
+}
+
+void AvroScan::StoreCache(const string &key, shared_ptr<IcebergCachedAvroFile> entry) {
+	if (disk_cache) {
+		disk_cache->Write(context, key, file_size, *entry);
+	}
+}
+
+void AvroScan::Bind() {
 	// Prepare the inputs for the bind
 	vector<Value> children;
 	children.reserve(1);
@@ -31,29 +66,108 @@ AvroScan::AvroScan(const string &scan_name, ClientContext &context, const string
 	dummy_table_function.get_multi_file_reader = IcebergAvroMultiFileReader::CreateInstance;
 	TableFunctionBindInput bind_input(children, named_params, input_types, input_names, nullptr, nullptr,
 	                                  dummy_table_function, empty);
-	bind_data = avro_scan->bind(context, bind_input, return_types, return_names);
+	vector<LogicalType> bound_types;
+	vector<string> bound_names;
+	bind_data = avro_scan.bind(context, bind_input, bound_types, bound_names);
+	if (!return_types.empty() && (bound_types != return_types || bound_names != return_names)) {
+		throw InvalidInputException("Schema of '%s' changed, manifests are expected to be immutable", path);
+	}
+	return_types = std::move(bound_types);
+	return_names = std::move(bound_names);
+}
+
+static void AppendProjection(const vector<ColumnIndex> &column_indexes, string &result) {
+	for (idx_t i = 0; i < column_indexes.size(); i++) {
+		auto &column_index = column_indexes[i];
+		if (i > 0) {
+			result += ",";
+		}
+		result += to_string(column_index.GetPrimaryIndex());
+		if (column_index.HasChildren()) {
+			result += "(";
+			AppendProjection(column_index.GetChildIndexes(), result);
+			result += ")";
+		}
+	}
+}
+
+//! The cache key of the scanned columns of the file
+static string GetProjectionKey(const string &path, const vector<ColumnIndex> &column_indexes) {
+	string result = path + "?columns=";
+	AppendProjection(column_indexes, result);
+	return result;
+}
+
+void AvroScan::InitializeScan(vector<ColumnIndex> column_indexes_p) {
+	if (column_indexes_p.empty() || !avro_scan.projection_pushdown) {
+		column_indexes_p.clear();
+		for (idx_t i = 0; i < return_types.size(); i++) {
+			column_indexes_p.emplace_back(i);
+		}
+	}
+	column_indexes = std::move(column_indexes_p);
+
+	if (disk_cache) {
+		cache_key = GetProjectionKey(path, column_indexes);
+		auto cached = LookupCache(cache_key);
+		if (cached && cached->data) {
+			cached_data = cached->data;
+			cached_data->InitializeScan(cached_scan_state);
+			return;
+		}
+	}
 
-	vector<column_t> column_ids;
-	for (idx_t i = 0; i < return_types.size(); i++) {
-		column_ids.push_back(i);
+	if (!bind_data) {
+		Bind();
 	}
 
 	ThreadContext thread_context(context);
 	ExecutionContext execution_context(context, thread_context, nullptr);
 
-	TableFunctionInitInput input(bind_data.get(), column_ids, vector<idx_t>(), nullptr);
-	global_state = avro_scan->init_global(context, input);
-	local_state = avro_scan->init_local(execution_context, input, global_state.get());
+	TableFunctionInitInput input(bind_data.get(), column_indexes, vector<idx_t>(), nullptr);
+	global_state = avro_scan.init_global(context, input);
+	local_state = avro_scan.init_local(execution_context, input, global_state.get());
+
+	if (buffer_limit != 0) {
+		//! Collect the decoded rows, to add them to the cache once the scan finishes
+		cache_data = make_shared_ptr<ColumnDataCollection>(Allocator::DefaultAllocator(), GetScanTypes());
+	}
+}
+
+vector<LogicalType> AvroScan::GetScanTypes() const {
+	vector<LogicalType> types;
+	for (auto &column_index : column_indexes) {
+		types.push_back(return_types[column_index.GetPrimaryIndex()]);
+	}
+	return types;
 }
 
 bool AvroScan::GetNext(DataChunk &result) {
-	TableFunctionInput function_input(bind_data.get(), local_state.get(), global_state.get());
-	avro_scan->function(context, function_input, result);
+	if (cached_data) {
+		result.Reset();
+		cached_data->Scan(cached_scan_state, result);
+	} else {
+		TableFunctionInput function_input(bind_data.get(), local_state.get(), global_state.get());
+		avro_scan.function(context, function_input, result);
+	}
 
 	idx_t count = result.size();
 	for (auto &vec : result.data) {
 		vec.Flatten(count);
 	}
+	if (cache_data) {
+		if (count != 0) {
+			cache_data->Append(result);
+			if (cache_data->AllocationSize() > buffer_limit) {
+				//! Too big to be cached
+				cache_data.reset();
+			}
+		} else {
+			auto entry = make_shared_ptr<IcebergCachedAvroFile>(return_types, return_names);
+			entry->data = std::move(cache_data);
+			StoreCache(cache_key, std::move(entry));
+		}
+	}
 	if (count == 0) {
 		finished = true;
 		return false;
@@ -62,7 +176,7 @@ bool AvroScan::GetNext(DataChunk &result) {
 }
 
 void AvroScan::InitializeChunk(DataChunk &chunk) {
-	chunk.Initialize(context, return_types, STANDARD_VECTOR_SIZE);
+	chunk.Initialize(context, GetScanTypes(), STANDARD_VECTOR_SIZE);
 }
 
 bool AvroScan::Finished() const {
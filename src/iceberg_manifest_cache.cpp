@@ -0,0 +1,352 @@
+#include "iceberg_manifest_cache.hpp"
+#include "iceberg_options.hpp"
+#include "iceberg_logging.hpp"
+#include "manifest_reader.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+static idx_t GetBoundsMemoryUsage(const unordered_map<int32_t, Value> &bounds) {
+	idx_t result = 0;
+	for (auto &bound : bounds) {
+		result += sizeof(bound);
+		if (!bound.second.IsNull()) {
+			result += StringValue::Get(bound.second).size();
+		}
+	}
+	return result;
+}
+
+idx_t IcebergCachedManifest::GetMemoryUsage() const {
+	//! Rough estimate of the memory that is held on to by the entry
+	idx_t result = sizeof(IcebergCachedManifest);
+	for (auto &manifest : manifests) {
+		result += sizeof(IcebergManifest) + manifest.manifest_path.size() +
+		          manifest.partitions.field_summary.size() * sizeof(FieldSummary);
+	}
+	result += data_files.GetMemoryUsage();
+	for (auto &entry : delete_files) {
+		result += sizeof(IcebergManifestEntry) + entry.file_path.size() + entry.referenced_data_file.size();
+		result += GetBoundsMemoryUsage(entry.lower_bounds) + GetBoundsMemoryUsage(entry.upper_bounds);
+	}
+	return result;
+}
+
+IcebergManifestCache &IcebergManifestCache::Get(ClientContext &context) {
+	auto &object_cache = ObjectCache::GetObjectCache(context);
+	return *object_cache.GetOrCreate<IcebergManifestCache>(CACHE_KEY);
+}
+
+idx_t IcebergManifestCache::ParseMemoryLimit(const string &limit) {
+	if (limit.empty() || limit == "0") {
+		return 0;
+	}
+	return DBConfig::ParseMemoryLimit(limit);
+}
+
+idx_t IcebergManifestCache::GetMemoryLimit(ClientContext &context) {
+	Value result;
+	(void)context.TryGetCurrentSetting(MANIFEST_CACHE_SIZE_CONFIG_VARIABLE, result);
+	if (result.IsNull()) {
+		return 0;
+	}
+	return ParseMemoryLimit(result.ToString());
+}
+
+vector<IcebergManifest> IcebergManifestCache::ReadManifestList(ClientContext &context, const string &path,
+                                                               idx_t iceberg_version) {
+	auto memory_limit = GetMemoryLimit(context);
+	if (memory_limit != 0) {
+		auto cached = Get(context).Get(path);
+		if (cached) {
+			return cached->manifests;
+		}
+	}
+	ManifestListReader manifest_list(iceberg_version);
+	manifest_list.Initialize(make_uniq<AvroScan>("IcebergManifestList", context, path));
+	vector<IcebergManifest> result;
+	while (!manifest_list.Finished()) {
+		manifest_list.Read(STANDARD_VECTOR_SIZE, result);
+	}
+	if (memory_limit != 0) {
+		auto entry = make_shared_ptr<IcebergCachedManifest>();
+		entry->manifests = result;
+		Get(context).Put(path, std::move(entry), memory_limit);
+	}
+	return result;
+}
+
+shared_ptr<IcebergCachedManifest> IcebergManifestCache::Get(const string &key) {
+	lock_guard<mutex> guard(lock);
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		return nullptr;
+	}
+	auto &entry = it->second;
+	//! Mark the entry as most recently used
+	lru.splice(lru.begin(), lru, entry.lru_position);
+	return entry.manifest;
+}
+
+void IcebergManifestCache::Put(const string &key, shared_ptr<IcebergCachedManifest> manifest, idx_t memory_limit) {
+	auto entry_memory_usage = manifest->GetMemoryUsage();
+	lock_guard<mutex> guard(lock);
+	if (entry_memory_usage > memory_limit) {
+		//! Doesn't fit in the cache at all
+		return;
+	}
+	auto it = entries.find(key);
+	if (it != entries.end()) {
+		//! Cached by another scan in the meantime, the contents are identical
+		lru.splice(lru.begin(), lru, it->second.lru_position);
+		return;
+	}
+	lru.push_front(key);
+	CacheEntry entry;
+	entry.manifest = std::move(manifest);
+	entry.memory_usage = entry_memory_usage;
+	entry.lru_position = lru.begin();
+	entries.emplace(key, std::move(entry));
+	memory_usage += entry_memory_usage;
+	Evict(memory_limit);
+}
+
+void IcebergManifestCache::Evict(idx_t memory_limit) {
+	while (memory_usage > memory_limit && !lru.empty()) {
+		auto it = entries.find(lru.back());
+		D_ASSERT(it != entries.end());
+		memory_usage -= it->second.memory_usage;
+		entries.erase(it);
+		lru.pop_back();
+	}
+}
+
+idx_t IcebergManifestCache::GetMemoryUsage() {
+	lock_guard<mutex> guard(lock);
+	return memory_usage;
+}
+
+//===--------------------------------------------------------------------===//
+// Disk Cache
+//===--------------------------------------------------------------------===//
+//! Bump when the layout of an entry changes, entries of other versions are ignored
+static constexpr const uint64_t DISK_CACHE_VERSION = 1;
+static constexpr const char *DISK_CACHE_EXTENSION = ".manifest";
+
+optional_ptr<IcebergManifestDiskCache> IcebergManifestDiskCache::TryGet(ClientContext &context) {
+	Value directory;
+	(void)context.TryGetCurrentSetting(MANIFEST_DISK_CACHE_DIRECTORY_CONFIG_VARIABLE, directory);
+	if (directory.IsNull() || directory.ToString().empty()) {
+		return nullptr;
+	}
+	auto directory_path = directory.ToString();
+	auto &object_cache = ObjectCache::GetObjectCache(context);
+	//! Every directory gets its own cache object
+	auto cache = object_cache.GetOrCreate<IcebergManifestDiskCache>(string(CACHE_KEY) + ":" + directory_path);
+	{
+		lock_guard<mutex> guard(cache->lock);
+		cache->directory = directory_path;
+	}
+	return cache.get();
+}
+
+idx_t IcebergManifestDiskCache::GetDiskQuota(ClientContext &context) {
+	Value result;
+	(void)context.TryGetCurrentSetting(MANIFEST_DISK_CACHE_SIZE_CONFIG_VARIABLE, result);
+	if (result.IsNull()) {
+		return 0;
+	}
+	return IcebergManifestCache::ParseMemoryLimit(result.ToString());
+}
+
+string IcebergManifestDiskCache::GetEntryPath(FileSystem &fs, const string &key) const {
+	return fs.JoinPath(directory, to_string(Hash(key.c_str())) + DISK_CACHE_EXTENSION);
+}
+
+void IcebergManifestDiskCache::Initialize(FileSystem &fs) {
+	if (initialized) {
+		return;
+	}
+	initialized = true;
+	if (!fs.DirectoryExists(directory)) {
+		fs.CreateDirectory(directory);
+	}
+
+	vector<pair<timestamp_t, pair<string, idx_t>>> existing_files;
+	fs.ListFiles(directory, [&](const string &name, bool is_directory) {
+		if (is_directory || !StringUtil::EndsWith(name, DISK_CACHE_EXTENSION)) {
+			return;
+		}
+		auto path = fs.JoinPath(directory, name);
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!handle) {
+			return;
+		}
+		auto size = NumericCast<idx_t>(handle->GetFileSize());
+		existing_files.emplace_back(fs.GetLastModifiedTime(*handle), make_pair(path, size));
+	});
+	//! Without a record of their uses, the entries of a previous run start out in the order they were written
+	std::sort(existing_files.begin(), existing_files.end());
+	for (auto &file : existing_files) {
+		Track(file.second.first, file.second.second);
+	}
+}
+
+void IcebergManifestDiskCache::Track(const string &path, idx_t size) {
+	D_ASSERT(!file_positions.count(path));
+	files.emplace_back(path, size);
+	file_positions[path] = std::prev(files.end());
+	disk_usage += size;
+}
+
+void IcebergManifestDiskCache::Touch(const string &path) {
+	auto it = file_positions.find(path);
+	if (it == file_positions.end()) {
+		return;
+	}
+	files.splice(files.end(), files, it->second);
+}
+
+void IcebergManifestDiskCache::Untrack(const string &path) {
+	auto it = file_positions.find(path);
+	if (it == file_positions.end()) {
+		return;
+	}
+	disk_usage -= it->second->second;
+	files.erase(it->second);
+	file_positions.erase(it);
+}
+
+void IcebergManifestDiskCache::Evict(FileSystem &fs, idx_t disk_quota) {
+	while (disk_usage > disk_quota && !files.empty()) {
+		auto &file = files.front();
+		fs.TryRemoveFile(file.first);
+		disk_usage -= file.second;
+		file_positions.erase(file.first);
+		files.pop_front();
+	}
+}
+
+shared_ptr<IcebergCachedAvroFile> IcebergManifestDiskCache::Read(ClientContext &context, const string &key,
+                                                                 idx_t source_size) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	string path;
+	{
+		lock_guard<mutex> guard(lock);
+		Initialize(fs);
+		path = GetEntryPath(fs, key);
+	}
+	if (!fs.FileExists(path)) {
+		return nullptr;
+	}
+	try {
+		BufferedFileReader reader(fs, path.c_str());
+		BinaryDeserializer deserializer(reader);
+		deserializer.Begin();
+		auto version = deserializer.ReadProperty<uint64_t>(100, "version");
+		auto entry_key = deserializer.ReadProperty<string>(101, "key");
+		auto entry_source_size = deserializer.ReadProperty<idx_t>(102, "source_size");
+		if (version != DISK_CACHE_VERSION || entry_key != key || entry_source_size != source_size) {
+			//! Not an entry for this (version of the) file
+			return nullptr;
+		}
+		auto types = deserializer.ReadProperty<vector<LogicalType>>(103, "types");
+		auto names = deserializer.ReadProperty<vector<string>>(104, "names");
+		auto result = make_shared_ptr<IcebergCachedAvroFile>(std::move(types), std::move(names));
+		auto has_data = deserializer.ReadProperty<bool>(105, "has_data");
+		if (has_data) {
+			auto data_types = deserializer.ReadProperty<vector<LogicalType>>(106, "data_types");
+			auto data = make_shared_ptr<ColumnDataCollection>(Allocator::DefaultAllocator(), std::move(data_types));
+			deserializer.ReadList(107, "chunks", [&](Deserializer::List &list, idx_t i) {
+				DataChunk chunk;
+				list.ReadObject([&](Deserializer &object) { chunk.Deserialize(object); });
+				data->Append(chunk);
+			});
+			result->data = std::move(data);
+		}
+		deserializer.End();
+
+		lock_guard<mutex> guard(lock);
+		Touch(path);
+		return result;
+	} catch (std::exception &ex) {
+		//! Treat an unreadable (e.g. partially written) entry as a miss
+		ErrorData error(ex);
+		DUCKDB_LOG(context, IcebergLogType, "Failed to read manifest cache entry '%s': %s", path, error.RawMessage());
+		lock_guard<mutex> guard(lock);
+		fs.TryRemoveFile(path);
+		Untrack(path);
+		return nullptr;
+	}
+}
+
+void IcebergManifestDiskCache::Write(ClientContext &context, const string &key, idx_t source_size,
+                                     const IcebergCachedAvroFile &file) {
+	auto disk_quota = GetDiskQuota(context);
+
+	auto &fs = FileSystem::GetFileSystem(context);
+	string path;
+	{
+		lock_guard<mutex> guard(lock);
+		Initialize(fs);
+		path = GetEntryPath(fs, key);
+	}
+	//! Write to a temporary file first, so a concurrent reader never sees a partially written entry
+	auto temp_path = path + ".tmp." + UUID::ToString(UUID::GenerateRandomUUID());
+	idx_t entry_size;
+	try {
+		BufferedFileWriter writer(fs, temp_path,
+		                          FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		BinarySerializer serializer(writer);
+		serializer.Begin();
+		serializer.WriteProperty(100, "version", DISK_CACHE_VERSION);
+		serializer.WriteProperty(101, "key", key);
+		serializer.WriteProperty(102, "source_size", source_size);
+		serializer.WriteProperty(103, "types", file.types);
+		serializer.WriteProperty(104, "names", file.names);
+		serializer.WriteProperty(105, "has_data", file.data != nullptr);
+		if (file.data) {
+			auto &data = *file.data;
+			serializer.WriteProperty(106, "data_types", data.Types());
+			ColumnDataScanState scan_state;
+			data.InitializeScan(scan_state);
+			DataChunk chunk;
+			data.InitializeScanChunk(chunk);
+			serializer.WriteList(107, "chunks", data.ChunkCount(), [&](Serializer::List &list, idx_t i) {
+				chunk.Reset();
+				data.Scan(scan_state, chunk);
+				list.WriteObject([&](Serializer &object) { chunk.Serialize(object); });
+			});
+		}
+		serializer.End();
+		writer.Sync();
+		entry_size = NumericCast<idx_t>(writer.GetFileSize());
+		writer.Close();
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		DUCKDB_LOG(context, IcebergLogType, "Failed to write manifest cache entry '%s': %s", path, error.RawMessage());
+		fs.TryRemoveFile(temp_path);
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	if (entry_size > disk_quota || file_positions.count(path) || fs.FileExists(path)) {
+		//! Doesn't fit within the quota, or was written by another scan in the meantime
+		fs.TryRemoveFile(temp_path);
+		return;
+	}
+	fs.MoveFile(temp_path, path);
+	Track(path, entry_size);
+	Evict(fs, disk_quota);
+}
+
+} // namespace duckdb
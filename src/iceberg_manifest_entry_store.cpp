@@ -0,0 +1,150 @@
+#include "iceberg_manifest_entry_store.hpp"
+
+namespace duckdb {
+
+IcebergManifestEntryStore::IcebergManifestEntryStore() {
+	heaps.push_back(make_uniq<StringHeap>());
+}
+
+idx_t IcebergManifestEntryStore::GetPartitionIndex(const Value &partition) {
+	auto it = partition_map.find(partition);
+	if (it != partition_map.end()) {
+		return it->second;
+	}
+	auto partition_index = partitions.size();
+	partitions.push_back(partition);
+	partition_map.emplace(partition, partition_index);
+	return partition_index;
+}
+
+idx_t IcebergManifestEntryStore::Append(const string_t &file_path, const string_t &file_format, int64_t record_count,
+                                        int64_t file_size_in_bytes, sequence_number_t sequence_number,
+                                        int32_t partition_spec_id, const Value &partition) {
+	auto &heap = *heaps.back();
+	auto index = Count();
+	file_paths.push_back(heap.AddString(file_path));
+	file_formats.push_back(heap.AddString(file_format));
+	record_counts.push_back(record_count);
+	file_sizes_in_bytes.push_back(file_size_in_bytes);
+	sequence_numbers.push_back(sequence_number);
+	partition_spec_ids.push_back(partition_spec_id);
+	partition_indexes.push_back(GetPartitionIndex(partition));
+	metrics_offsets.push_back(metrics.size());
+	return index;
+}
+
+idx_t IcebergManifestEntryStore::Append(const IcebergManifestEntryStore &other, idx_t index, bool copy_metrics,
+                                        const unordered_set<int32_t> &field_ids) {
+	auto result = Append(other.file_paths[index], other.file_formats[index], other.record_counts[index],
+	                     other.file_sizes_in_bytes[index], other.sequence_numbers[index],
+	                     other.partition_spec_ids[index], other.GetPartition(index));
+	if (!copy_metrics) {
+		return result;
+	}
+	auto end = other.GetMetricsEnd(index);
+	for (idx_t i = other.metrics_offsets[index]; i < end; i++) {
+		auto &other_metrics = other.metrics[i];
+		if (!field_ids.empty() && !field_ids.count(other_metrics.field_id)) {
+			continue;
+		}
+		//! The bounds point into the heaps of 'other', copy them into our own
+		auto &metrics = GetAppendedMetrics(AppendMetrics(other_metrics.field_id));
+		metrics = other_metrics;
+		if (metrics.has_lower_bound) {
+			metrics.lower_bound = AddBound(other_metrics.lower_bound);
+		}
+		if (metrics.has_upper_bound) {
+			metrics.upper_bound = AddBound(other_metrics.upper_bound);
+		}
+	}
+	return result;
+}
+
+idx_t IcebergManifestEntryStore::AppendMetrics(int32_t field_id) {
+	D_ASSERT(Count() != 0);
+	metrics.emplace_back(field_id);
+	return metrics.size() - 1;
+}
+
+string_t IcebergManifestEntryStore::AddBound(const string_t &bound) {
+	return heaps.back()->AddBlob(bound);
+}
+
+idx_t IcebergManifestEntryStore::GetMetricsEnd(idx_t index) const {
+	return index + 1 < metrics_offsets.size() ? metrics_offsets[index + 1] : metrics.size();
+}
+
+optional_ptr<const IcebergColumnMetrics> IcebergManifestEntryStore::GetMetrics(idx_t index, int32_t field_id) const {
+	auto end = GetMetricsEnd(index);
+	for (idx_t i = metrics_offsets[index]; i < end; i++) {
+		if (metrics[i].field_id == field_id) {
+			return metrics[i];
+		}
+	}
+	return nullptr;
+}
+
+bool IcebergManifestEntryStore::HasBounds(idx_t index) const {
+	bool has_lower_bound = false;
+	bool has_upper_bound = false;
+	auto end = GetMetricsEnd(index);
+	for (idx_t i = metrics_offsets[index]; i < end; i++) {
+		has_lower_bound = has_lower_bound || metrics[i].has_lower_bound;
+		has_upper_bound = has_upper_bound || metrics[i].has_upper_bound;
+	}
+	return has_lower_bound && has_upper_bound;
+}
+
+idx_t IcebergManifestEntryStore::GetMemoryUsage() const {
+	idx_t result = sizeof(IcebergManifestEntryStore);
+	for (auto &heap : heaps) {
+		result += heap->AllocationSize();
+	}
+	//! The arrays of the fields
+	result += Count() * (2 * sizeof(string_t) + 3 * sizeof(int64_t) + sizeof(int32_t) + 2 * sizeof(idx_t));
+	result += metrics.size() * sizeof(IcebergColumnMetrics);
+	for (auto &partition : partitions) {
+		result += sizeof(Value) + partition.ToString().size();
+	}
+	return result;
+}
+
+void IcebergManifestEntryStore::Merge(IcebergManifestEntryStore &other) {
+	if (other.Count() == 0) {
+		return;
+	}
+	//! The strings point into the heaps of 'other', take ownership of them
+	for (auto &heap : other.heaps) {
+		heaps.push_back(std::move(heap));
+	}
+	other.heaps.clear();
+	//! Keep appending to a heap that is owned by this store
+	heaps.push_back(make_uniq<StringHeap>());
+
+	file_paths.insert(file_paths.end(), other.file_paths.begin(), other.file_paths.end());
+	file_formats.insert(file_formats.end(), other.file_formats.begin(), other.file_formats.end());
+	record_counts.insert(record_counts.end(), other.record_counts.begin(), other.record_counts.end());
+	file_sizes_in_bytes.insert(file_sizes_in_bytes.end(), other.file_sizes_in_bytes.begin(),
+	                           other.file_sizes_in_bytes.end());
+	sequence_numbers.insert(sequence_numbers.end(), other.sequence_numbers.begin(), other.sequence_numbers.end());
+	partition_spec_ids.insert(partition_spec_ids.end(), other.partition_spec_ids.begin(),
+	                          other.partition_spec_ids.end());
+
+	auto metrics_start = metrics.size();
+	for (auto &offset : other.metrics_offsets) {
+		metrics_offsets.push_back(offset + metrics_start);
+	}
+	metrics.insert(metrics.end(), other.metrics.begin(), other.metrics.end());
+
+	vector<idx_t> partition_remap;
+	for (auto &partition : other.partitions) {
+		partition_remap.push_back(GetPartitionIndex(partition));
+	}
+	for (auto &partition_index : other.partition_indexes) {
+		partition_indexes.push_back(partition_remap[partition_index]);
+	}
+
+	other = IcebergManifestEntryStore();
+}
+
+} // namespace duckdb
@@ -0,0 +1,453 @@
+#include "iceberg_optimizer.hpp"
+#include "iceberg_logging.hpp"
+#include "iceberg_multi_file_list.hpp"
+#include "iceberg_options.hpp"
+#include "iceberg_predicate.hpp"
+#include "iceberg_table_statistics.hpp"
+
+#include "duckdb/common/multi_file/multi_file_data.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/expression_filter.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+enum class IcebergMetadataAggregateType : uint8_t { COUNT_STAR, COUNT, MIN, MAX };
+
+//! An aggregate that is (partially) answered from the metrics of the data files
+struct IcebergMetadataAggregate {
+public:
+	explicit IcebergMetadataAggregate(IcebergMetadataAggregateType type) : type(type) {
+	}
+
+public:
+	IcebergMetadataAggregateType type;
+	//! The (top-level) column of the schema that is aggregated, unused for COUNT_STAR
+	idx_t column_index = DConstants::INVALID_INDEX;
+	//! The aggregate over the answered data files
+	int64_t count = 0;
+	//! NULL as long as no answered data file had a (non-NULL) value
+	Value bound;
+};
+
+//! A pushed down filter of the scan, on a (top-level) column of the schema
+struct IcebergMetadataFilter {
+public:
+	IcebergMetadataFilter(idx_t column_index, TableFilter &filter) : column_index(column_index), filter(filter) {
+	}
+
+public:
+	idx_t column_index;
+	TableFilter &filter;
+};
+
+static optional_ptr<LogicalGet> FindIcebergScan(LogicalOperator &op) {
+	reference<LogicalOperator> current = op;
+	while (current.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		current = *current.get().children[0];
+	}
+	if (current.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = current.get().Cast<LogicalGet>();
+	if (get.function.name != "iceberg_scan" || !get.bind_data) {
+		return nullptr;
+	}
+	return get;
+}
+
+//! Resolve the position of a column of the scan to the (top-level) column of the schema
+static bool ResolveScanColumn(const LogicalGet &get, idx_t column_position, idx_t column_count, idx_t &result) {
+	auto &column_ids = get.GetColumnIds();
+	if (column_position >= column_ids.size()) {
+		return false;
+	}
+	auto &column_index = column_ids[column_position];
+	if (column_index.HasChildren() || column_index.GetPrimaryIndex() >= column_count) {
+		//! A struct field or a virtual column
+		return false;
+	}
+	result = column_index.GetPrimaryIndex();
+	return true;
+}
+
+//! Follow a column reference through the projections to the (top-level) column of the schema
+static bool ResolveColumnReference(LogicalOperator &op, const Expression &expr, const LogicalGet &get,
+                                   idx_t column_count, idx_t &result) {
+	if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+		return false;
+	}
+	auto binding = expr.Cast<BoundColumnRefExpression>().binding;
+	reference<LogicalOperator> current = op;
+	while (current.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &projection = current.get().Cast<LogicalProjection>();
+		if (binding.table_index != projection.table_index) {
+			return false;
+		}
+		auto &projected = *projection.expressions[binding.column_index];
+		if (projected.type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		binding = projected.Cast<BoundColumnRefExpression>().binding;
+		current = *projection.children[0];
+	}
+	if (binding.table_index != get.table_index) {
+		return false;
+	}
+	auto column_position = binding.column_index;
+	if (!get.projection_ids.empty()) {
+		if (column_position >= get.projection_ids.size()) {
+			return false;
+		}
+		column_position = get.projection_ids[column_position];
+	}
+	return ResolveScanColumn(get, column_position, column_count, result);
+}
+
+static bool BindAggregates(LogicalAggregate &aggregate, const LogicalGet &get, const IcebergTableSchema &schema,
+                           vector<IcebergMetadataAggregate> &result) {
+	auto &columns = schema.columns;
+	for (auto &expr : aggregate.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+			return false;
+		}
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct() || aggr.filter || aggr.order_bys) {
+			return false;
+		}
+		auto &name = aggr.function.name;
+		if (name == "count_star" && aggr.children.empty()) {
+			result.emplace_back(IcebergMetadataAggregateType::COUNT_STAR);
+			continue;
+		}
+		if (aggr.children.size() != 1) {
+			return false;
+		}
+		IcebergMetadataAggregateType type;
+		if (name == "count") {
+			type = IcebergMetadataAggregateType::COUNT;
+		} else if (name == "min") {
+			type = IcebergMetadataAggregateType::MIN;
+		} else if (name == "max") {
+			type = IcebergMetadataAggregateType::MAX;
+		} else {
+			return false;
+		}
+		IcebergMetadataAggregate metadata_aggregate(type);
+		if (!ResolveColumnReference(*aggregate.children[0], *aggr.children[0], get, columns.size(),
+		                            metadata_aggregate.column_index)) {
+			return false;
+		}
+		auto &column_type = columns[metadata_aggregate.column_index]->type;
+		if (type != IcebergMetadataAggregateType::COUNT) {
+			//! The bounds of these types are exact (not truncated), and have to be returned as-is
+			if (!IcebergTableStatistics::SupportsBounds(column_type) || aggr.return_type != column_type) {
+				return false;
+			}
+		}
+		result.push_back(std::move(metadata_aggregate));
+	}
+	return !result.empty();
+}
+
+//! Whether the metrics of a data file can prove that the filter matches all of its rows (see MatchesAllValues)
+static bool CanMatchAllValues(const TableFilter &filter, const LogicalType &type) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		//! The bounds of other types can be truncated, or don't account for NaN
+		if (!IcebergTableStatistics::SupportsBounds(type)) {
+			return false;
+		}
+		switch (filter.Cast<ConstantFilter>().comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			return true;
+		default:
+			return false;
+		}
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child : conjunction_and_filter.child_filters) {
+			if (!CanMatchAllValues(*child, type)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::EXPRESSION_FILTER:
+		return filter.Cast<ExpressionFilter>().expr->type == ExpressionType::OPERATOR_IS_NOT_NULL;
+	default:
+		return false;
+	}
+}
+
+static bool BindFilters(const LogicalGet &get, const IcebergTableSchema &schema,
+                        vector<IcebergMetadataFilter> &result) {
+	for (auto &entry : get.table_filters.filters) {
+		idx_t column_index;
+		if (!ResolveScanColumn(get, entry.first, schema.columns.size(), column_index)) {
+			return false;
+		}
+		if (!CanMatchAllValues(*entry.second, schema.columns[column_index]->type)) {
+			//! No data file can be answered, reading the metrics would be wasted
+			return false;
+		}
+		result.emplace_back(column_index, *entry.second);
+	}
+	return true;
+}
+
+static bool IsFloatingPoint(const LogicalType &type) {
+	return type.id() == LogicalTypeId::FLOAT || type.id() == LogicalTypeId::DOUBLE;
+}
+
+//! Whether no row of the data file is removed by the filters
+static bool MatchesAllRows(const IcebergManifestEntryStore &data_files, idx_t file_idx,
+                           const vector<IcebergMetadataFilter> &filters, const IcebergTableSchema &schema) {
+	for (auto &entry : filters) {
+		auto &column = *schema.columns[entry.column_index];
+		auto metrics = data_files.GetMetrics(file_idx, column.id);
+		if (!metrics || !metrics->has_lower_bound || !metrics->has_upper_bound || metrics->null_value_count < 0) {
+			return false;
+		}
+		if (IsFloatingPoint(column.type) && metrics->nan_value_count < 0) {
+			return false;
+		}
+		IcebergPredicateStats stats;
+		stats.lower_bound =
+		    IcebergPredicateStats::DeserializeBound(metrics->lower_bound, column.name, column.type, "lower bound");
+		stats.upper_bound =
+		    IcebergPredicateStats::DeserializeBound(metrics->upper_bound, column.name, column.type, "upper bound");
+		stats.has_null = metrics->null_value_count > 0;
+		stats.has_nan = metrics->nan_value_count > 0;
+		if (!IcebergPredicate::MatchesAllValues(entry.filter, stats)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Whether every aggregate can be answered exactly for the data file
+static bool CanAnswer(const IcebergManifestEntryStore &data_files, idx_t file_idx,
+                      const vector<IcebergMetadataAggregate> &aggregates, const IcebergTableSchema &schema) {
+	for (auto &aggregate : aggregates) {
+		if (aggregate.type == IcebergMetadataAggregateType::COUNT_STAR) {
+			continue;
+		}
+		auto &column = *schema.columns[aggregate.column_index];
+		auto metrics = data_files.GetMetrics(file_idx, column.id);
+		if (!metrics || metrics->null_value_count < 0) {
+			return false;
+		}
+		if (aggregate.type == IcebergMetadataAggregateType::COUNT) {
+			continue;
+		}
+		if (metrics->null_value_count == data_files.GetRecordCount(file_idx)) {
+			//! Only NULLs, nothing to contribute
+			continue;
+		}
+		if (!metrics->has_lower_bound || !metrics->has_upper_bound) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void Answer(const IcebergManifestEntryStore &data_files, idx_t file_idx,
+                   vector<IcebergMetadataAggregate> &aggregates, const IcebergTableSchema &schema) {
+	auto record_count = data_files.GetRecordCount(file_idx);
+	for (auto &aggregate : aggregates) {
+		if (aggregate.type == IcebergMetadataAggregateType::COUNT_STAR) {
+			aggregate.count += record_count;
+			continue;
+		}
+		auto &column = *schema.columns[aggregate.column_index];
+		auto metrics = data_files.GetMetrics(file_idx, column.id);
+		D_ASSERT(metrics);
+		if (aggregate.type == IcebergMetadataAggregateType::COUNT) {
+			aggregate.count += record_count - metrics->null_value_count;
+			continue;
+		}
+		if (metrics->null_value_count == record_count) {
+			continue;
+		}
+		if (aggregate.type == IcebergMetadataAggregateType::MIN) {
+			auto lower_bound =
+			    IcebergPredicateStats::DeserializeBound(metrics->lower_bound, column.name, column.type, "lower bound");
+			if (aggregate.bound.IsNull() || lower_bound < aggregate.bound) {
+				aggregate.bound = std::move(lower_bound);
+			}
+		} else {
+			auto upper_bound =
+			    IcebergPredicateStats::DeserializeBound(metrics->upper_bound, column.name, column.type, "upper bound");
+			if (aggregate.bound.IsNull() || upper_bound > aggregate.bound) {
+				aggregate.bound = std::move(upper_bound);
+			}
+		}
+	}
+}
+
+//! Combine the result of the aggregate over the scanned data files with the answer from the metadata
+static unique_ptr<Expression> CombineAggregate(ClientContext &context, unique_ptr<Expression> scanned,
+                                               const IcebergMetadataAggregate &aggregate) {
+	string function_name;
+	Value answer;
+	switch (aggregate.type) {
+	case IcebergMetadataAggregateType::COUNT_STAR:
+	case IcebergMetadataAggregateType::COUNT:
+		function_name = "+";
+		answer = Value::BIGINT(aggregate.count);
+		break;
+	case IcebergMetadataAggregateType::MIN:
+		function_name = "least";
+		answer = aggregate.bound;
+		break;
+	case IcebergMetadataAggregateType::MAX:
+		function_name = "greatest";
+		answer = aggregate.bound;
+		break;
+	default:
+		throw InternalException("IcebergMetadataAggregateType not implemented");
+	}
+	if (answer.IsNull()) {
+		//! Nothing was answered from the metadata
+		return scanned;
+	}
+	auto return_type = scanned->return_type;
+	vector<unique_ptr<Expression>> children;
+	children.push_back(std::move(scanned));
+	children.push_back(make_uniq<BoundConstantExpression>(std::move(answer)));
+
+	FunctionBinder function_binder(context);
+	ErrorData error;
+	auto result = function_binder.BindScalarFunction(DEFAULT_SCHEMA, function_name, std::move(children), error,
+	                                                 function_name == "+");
+	if (!result || result->return_type != return_type) {
+		return nullptr;
+	}
+	return result;
+}
+
+static bool IsEnabled(ClientContext &context) {
+	Value result;
+	(void)context.TryGetCurrentSetting(METADATA_AGGREGATES_CONFIG_VARIABLE, result);
+	return result.IsNull() || result.GetValue<bool>();
+}
+
+static bool TryAnswerFromMetadata(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &op) {
+	auto &context = input.context;
+	if (!IsEnabled(context)) {
+		return false;
+	}
+	auto &aggregate = op->Cast<LogicalAggregate>();
+	if (!aggregate.groups.empty() || !aggregate.grouping_functions.empty() || aggregate.grouping_sets.size() > 1) {
+		return false;
+	}
+	auto get = FindIcebergScan(*aggregate.children[0]);
+	if (!get) {
+		return false;
+	}
+	auto &bind_data = get->bind_data->Cast<MultiFileBindData>();
+	auto file_list = dynamic_cast<IcebergMultiFileList *>(bind_data.file_list.get());
+	if (!file_list || !file_list->GetSnapshot() || file_list->skipped_data_files) {
+		return false;
+	}
+	auto &schema = file_list->GetSchema();
+
+	vector<IcebergMetadataAggregate> aggregates;
+	vector<IcebergMetadataFilter> filters;
+	if (!BindAggregates(aggregate, *get, schema, aggregates) || !BindFilters(*get, schema, filters)) {
+		return false;
+	}
+	unordered_set<int32_t> field_ids;
+	for (auto &aggregate : aggregates) {
+		if (aggregate.type != IcebergMetadataAggregateType::COUNT_STAR) {
+			field_ids.insert(schema.columns[aggregate.column_index]->id);
+		}
+	}
+	for (auto &filter : filters) {
+		field_ids.insert(schema.columns[filter.column_index]->id);
+	}
+	//! Read through the manifest cache, so the scan of the remaining data files reuses the decoded manifests
+	IcebergManifestEntryStore data_files;
+	if (!file_list->ReadDataFileMetrics(field_ids, data_files)) {
+		//! The metrics of a data file don't account for the rows deleted from it
+		return false;
+	}
+
+	unordered_set<string> answered_files;
+	for (idx_t file_idx = 0; file_idx < data_files.Count(); file_idx++) {
+		if (!MatchesAllRows(data_files, file_idx, filters, schema) ||
+		    !CanAnswer(data_files, file_idx, aggregates, schema)) {
+			continue;
+		}
+		Answer(data_files, file_idx, aggregates, schema);
+		answered_files.insert(data_files.GetFilePath(file_idx).GetString());
+	}
+	if (answered_files.empty()) {
+		return false;
+	}
+
+	//! The aggregate moves to a new index, the projection on top of it takes over the bindings of the aggregate
+	auto new_aggregate_index = input.optimizer.binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> select_list;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &return_type = aggregate.expressions[i]->return_type;
+		auto scanned = make_uniq<BoundColumnRefExpression>(return_type, ColumnBinding(new_aggregate_index, i));
+		auto combined = CombineAggregate(context, std::move(scanned), aggregates[i]);
+		if (!combined) {
+			return false;
+		}
+		select_list.push_back(std::move(combined));
+	}
+
+	DUCKDB_LOG(context, IcebergLogType, "Iceberg Metadata Aggregate, answered %d of the %d data files",
+	           answered_files.size(), data_files.Count());
+	TableFilterSet no_new_filters;
+	auto restricted_list = file_list->PushdownInternal(context, no_new_filters);
+	restricted_list->skipped_data_files = make_shared_ptr<unordered_set<string>>(std::move(answered_files));
+	bind_data.file_list = std::move(restricted_list);
+
+	auto aggregate_index = aggregate.aggregate_index;
+	aggregate.aggregate_index = new_aggregate_index;
+	auto projection = make_uniq<LogicalProjection>(aggregate_index, std::move(select_list));
+	projection->children.push_back(std::move(op));
+	op = std::move(projection);
+	return true;
+}
+
+static void OptimizeRecursive(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &op) {
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY && TryAnswerFromMetadata(input, op)) {
+		return;
+	}
+	for (auto &child : op->children) {
+		OptimizeRecursive(input, child);
+	}
+}
+
+void IcebergOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	OptimizeRecursive(input, plan);
+}
+
+OptimizerExtension IcebergOptimizer::GetOptimizerExtension() {
+	OptimizerExtension result;
+	result.optimize_function = Optimize;
+	return result;
+}
+
+} // namespace duckdb
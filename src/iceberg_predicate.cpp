@@ -3,6 +3,11 @@
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/expression_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
 
@@ -27,6 +32,10 @@ static bool MatchBoundsConstantFilter(ConstantFilter &constant_filter, const Ice
 	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
 		return TRANSFORM::CompareGreaterThanOrEqual(constant_value, stats);
 	case ExpressionType::COMPARE_LESSTHAN:
+		if (TRANSFORM::StartsPartition(constant_filter.constant, transform)) {
+			//! Only values of earlier partitions are smaller than the constant
+			return IdentityTransform::CompareLessThan(constant_value, stats);
+		}
 		return TRANSFORM::CompareLessThan(constant_value, stats);
 	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
 		return TRANSFORM::CompareLessThanOrEqual(constant_value, stats);
@@ -36,6 +45,77 @@ static bool MatchBoundsConstantFilter(ConstantFilter &constant_filter, const Ice
 	}
 }
 
+template <class TRANSFORM>
+static bool MatchBoundsInFilter(InFilter &in_filter, const IcebergPredicateStats &stats,
+                                const IcebergTransform &transform) {
+	if (stats.lower_bound.IsNull() || stats.upper_bound.IsNull()) {
+		return true;
+	}
+	auto &values = in_filter.values;
+	if (!TRANSFORM::PRESERVES_ORDER) {
+		for (auto &value : values) {
+			auto constant_value = TRANSFORM::ApplyTransform(value, transform);
+			if (constant_value.IsNull() || TRANSFORM::CompareEqual(constant_value, stats)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	//! The values are sorted (see PrepareFilter) and stay sorted after the transform,
+	//! binary search for the first value that isn't below the lower bound
+	idx_t lower = 0;
+	idx_t upper = values.size();
+	while (lower < upper) {
+		auto middle = lower + (upper - lower) / 2;
+		auto constant_value = TRANSFORM::ApplyTransform(values[middle], transform);
+		if (constant_value.IsNull()) {
+			return true;
+		}
+		if (constant_value < stats.lower_bound) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	if (lower == values.size()) {
+		//! All values are below the lower bound
+		return false;
+	}
+	auto constant_value = TRANSFORM::ApplyTransform(values[lower], transform);
+	return constant_value.IsNull() || TRANSFORM::CompareEqual(constant_value, stats);
+}
+
+//! 'LIKE 'abc%'' is rewritten to 'prefix(col, 'abc')', which is pushed down as an ExpressionFilter
+static bool TryGetPrefixConstant(const Expression &expr, Value &result) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.function.name != "prefix" || func.children.size() != 2) {
+		return false;
+	}
+	auto &prefix = *func.children[1];
+	if (prefix.GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return false;
+	}
+	auto &constant = prefix.Cast<BoundConstantExpression>().value;
+	if (constant.IsNull() || constant.type().id() != LogicalTypeId::VARCHAR) {
+		return false;
+	}
+	result = constant;
+	return true;
+}
+
+template <class TRANSFORM>
+static bool MatchBoundsPrefixFilter(const Value &prefix, const IcebergPredicateStats &stats,
+                                    const IcebergTransform &transform) {
+	auto constant_value = TRANSFORM::ApplyTransform(prefix, transform);
+	if (constant_value.IsNull() || stats.lower_bound.IsNull() || stats.upper_bound.IsNull()) {
+		return true;
+	}
+	return TRANSFORM::CompareStartsWith(constant_value, stats);
+}
+
 template <class TRANSFORM>
 static bool MatchBoundsIsNullFilter(const IcebergPredicateStats &stats, const IcebergTransform &transform) {
 	return stats.has_null == true;
@@ -57,9 +137,19 @@ static bool MatchBoundsConjunctionAndFilter(ConjunctionAndFilter &conjunction_an
 	return true;
 }
 
+template <class TRANSFORM>
+static bool MatchBoundsConjunctionOrFilter(ConjunctionOrFilter &conjunction_or, const IcebergPredicateStats &stats,
+                                           const IcebergTransform &transform) {
+	for (auto &child : conjunction_or.child_filters) {
+		if (MatchBoundsTemplated<TRANSFORM>(*child, stats, transform)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 template <class TRANSFORM>
 bool MatchBoundsTemplated(TableFilter &filter, const IcebergPredicateStats &stats, const IcebergTransform &transform) {
-	//! TODO: support more filter types
 	switch (filter.filter_type) {
 	case TableFilterType::CONSTANT_COMPARISON: {
 		auto &constant_filter = filter.Cast<ConstantFilter>();
@@ -69,6 +159,36 @@ bool MatchBoundsTemplated(TableFilter &filter, const IcebergPredicateStats &stat
 		auto &conjunction_and_filter = filter.Cast<ConjunctionAndFilter>();
 		return MatchBoundsConjunctionAndFilter<TRANSFORM>(conjunction_and_filter, stats, transform);
 	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_or_filter = filter.Cast<ConjunctionOrFilter>();
+		return MatchBoundsConjunctionOrFilter<TRANSFORM>(conjunction_or_filter, stats, transform);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		return MatchBoundsInFilter<TRANSFORM>(in_filter, stats, transform);
+	}
+	case TableFilterType::OPTIONAL_FILTER: {
+		//! The optional filter is implied by the query, it's only optional to evaluate it
+		auto &optional_filter = filter.Cast<OptionalFilter>();
+		if (!optional_filter.child_filter) {
+			return true;
+		}
+		return MatchBoundsTemplated<TRANSFORM>(*optional_filter.child_filter, stats, transform);
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		//! The value is set (and tightened) during execution, i.e. by a Top-N, so it's checked when a manifest or
+		//! data file is read, rows it rules out at that point can't become part of the result anymore
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			return true;
+		}
+		auto &filter_data = *dynamic_filter.filter_data;
+		lock_guard<mutex> guard(filter_data.lock);
+		if (!filter_data.initialized || !filter_data.filter) {
+			return true;
+		}
+		return MatchBoundsConstantFilter<TRANSFORM>(*filter_data.filter, stats, transform);
+	}
 	case TableFilterType::IS_NULL: {
 		//! FIXME: these are never hit, because it goes through ExpressionFilter instead?
 		return MatchBoundsIsNullFilter<TRANSFORM>(stats, transform);
@@ -86,6 +206,10 @@ bool MatchBoundsTemplated(TableFilter &filter, const IcebergPredicateStats &stat
 		if (expr.type == ExpressionType::OPERATOR_IS_NOT_NULL) {
 			return MatchBoundsIsNotNullFilter<TRANSFORM>(stats, transform);
 		}
+		Value prefix;
+		if (TryGetPrefixConstant(expr, prefix)) {
+			return MatchBoundsPrefixFilter<TRANSFORM>(prefix, stats, transform);
+		}
 		//! Any other expression can not be filtered
 		return true;
 	}
@@ -95,24 +219,103 @@ bool MatchBoundsTemplated(TableFilter &filter, const IcebergPredicateStats &stat
 	}
 }
 
+static bool MatchesAllValuesConstantFilter(ConstantFilter &constant_filter, const IcebergPredicateStats &stats) {
+	auto &constant = constant_filter.constant;
+	if (constant.IsNull() || stats.lower_bound.IsNull() || stats.upper_bound.IsNull()) {
+		return false;
+	}
+	if (stats.has_null || stats.has_nan) {
+		//! NULL (and NaN) values don't match a comparison
+		return false;
+	}
+	switch (constant_filter.comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return stats.lower_bound == constant && stats.upper_bound == constant;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return stats.lower_bound > constant;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return stats.lower_bound >= constant;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return stats.upper_bound < constant;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return stats.upper_bound <= constant;
+	default:
+		return false;
+	}
+}
+
+bool IcebergPredicate::MatchesAllValues(TableFilter &filter, const IcebergPredicateStats &stats) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return MatchesAllValuesConstantFilter(filter.Cast<ConstantFilter>(), stats);
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child : conjunction_and_filter.child_filters) {
+			if (!MatchesAllValues(*child, stats)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::IS_NOT_NULL:
+		return !stats.has_null;
+	case TableFilterType::EXPRESSION_FILTER: {
+		auto &expression_filter = filter.Cast<ExpressionFilter>();
+		if (expression_filter.expr->type == ExpressionType::OPERATOR_IS_NOT_NULL) {
+			return !stats.has_null;
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+void IcebergPredicate::PrepareFilter(TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		std::sort(in_filter.values.begin(), in_filter.values.end(),
+		          [](const Value &a, const Value &b) { return a < b; });
+		break;
+	}
+	case TableFilterType::CONJUNCTION_AND:
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_filter = filter.Cast<ConjunctionFilter>();
+		for (auto &child : conjunction_filter.child_filters) {
+			PrepareFilter(*child);
+		}
+		break;
+	}
+	case TableFilterType::OPTIONAL_FILTER: {
+		auto &optional_filter = filter.Cast<OptionalFilter>();
+		if (optional_filter.child_filter) {
+			PrepareFilter(*optional_filter.child_filter);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+}
+
 bool IcebergPredicate::MatchBounds(TableFilter &filter, const IcebergPredicateStats &stats,
                                    const IcebergTransform &transform) {
 	switch (transform.Type()) {
 	case IcebergTransformType::IDENTITY:
 		return MatchBoundsTemplated<IdentityTransform>(filter, stats, transform);
 	case IcebergTransformType::BUCKET:
-		return true;
+		return MatchBoundsTemplated<BucketTransform>(filter, stats, transform);
 	case IcebergTransformType::TRUNCATE:
-		return true;
+		return MatchBoundsTemplated<TruncateTransform>(filter, stats, transform);
 	case IcebergTransformType::YEAR:
 		return MatchBoundsTemplated<YearTransform>(filter, stats, transform);
 	case IcebergTransformType::MONTH:
-		return true;
+		return MatchBoundsTemplated<MonthTransform>(filter, stats, transform);
 	case IcebergTransformType::DAY:
-		// return MatchBoundsTemplated<DayTransform>(filter, stats, transform);
-		return true;
+		return MatchBoundsTemplated<DayTransform>(filter, stats, transform);
 	case IcebergTransformType::HOUR:
-		return true;
+		return MatchBoundsTemplated<HourTransform>(filter, stats, transform);
 	case IcebergTransformType::VOID:
 		return true;
 	default:
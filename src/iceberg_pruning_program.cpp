@@ -0,0 +1,274 @@
+#include "iceberg_pruning_program.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
+
+namespace duckdb {
+
+//! ----------- Bound Decoders -----------
+//! Decode a single-value serialized bound, see https://iceberg.apache.org/spec/#binary-single-value-serialization
+
+template <class T>
+static bool DecodeLittleEndian(const string_t &bound, T &result) {
+	if (bound.GetSize() != sizeof(T)) {
+		return false;
+	}
+	std::memcpy(&result, bound.GetData(), sizeof(T));
+	return true;
+}
+
+//! int and date
+struct Int32BoundDecoder {
+	using TYPE = int32_t;
+	static bool TryDecode(const string_t &bound, int32_t &result) {
+		return DecodeLittleEndian(bound, result);
+	}
+};
+
+//! long, which can still have 'int' bounds in files written before it was promoted
+struct Int64BoundDecoder {
+	using TYPE = int64_t;
+	static bool TryDecode(const string_t &bound, int64_t &result) {
+		int32_t promoted;
+		if (DecodeLittleEndian(bound, promoted)) {
+			result = promoted;
+			return true;
+		}
+		return DecodeLittleEndian(bound, result);
+	}
+};
+
+//! time, timestamp and timestamptz (in microseconds)
+struct MicrosBoundDecoder {
+	using TYPE = int64_t;
+	static bool TryDecode(const string_t &bound, int64_t &result) {
+		return DecodeLittleEndian(bound, result);
+	}
+};
+
+struct FloatBoundDecoder {
+	using TYPE = float;
+	static bool TryDecode(const string_t &bound, float &result) {
+		return DecodeLittleEndian(bound, result);
+	}
+};
+
+//! double, which can still have 'float' bounds in files written before it was promoted
+struct DoubleBoundDecoder {
+	using TYPE = double;
+	static bool TryDecode(const string_t &bound, double &result) {
+		float promoted;
+		if (DecodeLittleEndian(bound, promoted)) {
+			result = promoted;
+			return true;
+		}
+		return DecodeLittleEndian(bound, result);
+	}
+};
+
+//! string, the UTF-8 bytes compare the same as the strings
+struct StringBoundDecoder {
+	using TYPE = string_t;
+	static bool TryDecode(const string_t &bound, string_t &result) {
+		result = bound;
+		return true;
+	}
+};
+
+//! ----------- Typed Column Pruner -----------
+
+//! The filter of a column as a range of values, checked against bounds of the physical type of the column
+template <class DECODER>
+class TypedColumnPruner : public IcebergColumnPruner {
+public:
+	using T = typename DECODER::TYPE;
+
+public:
+	explicit TypedColumnPruner(const LogicalType &type) : type(type) {
+	}
+
+public:
+	//! Narrow the range with the comparison, returns false if it can't be compiled
+	bool TryAddComparison(ExpressionType comparison_type, const Value &constant_p) {
+		if (constant_p.IsNull() || constant_p.type() != type) {
+			return false;
+		}
+		if (type.id() == LogicalTypeId::FLOAT && Value::IsNan(constant_p.GetValue<float>())) {
+			return false;
+		}
+		if (type.id() == LogicalTypeId::DOUBLE && Value::IsNan(constant_p.GetValue<double>())) {
+			return false;
+		}
+		//! The constants are kept alive, string constants are referenced by the range
+		constants.push_back(constant_p);
+		auto constant = constants.back().GetValueUnsafe<T>();
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			SetLower(constant, true);
+			SetUpper(constant, true);
+			return true;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			SetLower(constant, false);
+			return true;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			SetLower(constant, true);
+			return true;
+		case ExpressionType::COMPARE_LESSTHAN:
+			SetUpper(constant, false);
+			return true;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			SetUpper(constant, true);
+			return true;
+		default:
+			constants.pop_back();
+			return false;
+		}
+	}
+	bool HasRange() const {
+		return has_lower || has_upper;
+	}
+
+	bool MatchBounds(const string_t *lower_bound, const string_t *upper_bound) const override {
+		if (!lower_bound || !upper_bound) {
+			return true;
+		}
+		T file_lower;
+		T file_upper;
+		if (!DECODER::TryDecode(*lower_bound, file_lower) || !DECODER::TryDecode(*upper_bound, file_upper)) {
+			//! Unexpected serialization, leave it to the generic path
+			return true;
+		}
+		if (has_lower) {
+			if (LessThan::Operation(file_upper, lower) || (!lower_inclusive && Equals::Operation(file_upper, lower))) {
+				return false;
+			}
+		}
+		if (has_upper) {
+			if (GreaterThan::Operation(file_lower, upper) ||
+			    (!upper_inclusive && Equals::Operation(file_lower, upper))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+private:
+	void SetLower(T constant, bool inclusive) {
+		if (!has_lower || GreaterThan::Operation(constant, lower) ||
+		    (Equals::Operation(constant, lower) && !inclusive)) {
+			lower = constant;
+			lower_inclusive = inclusive;
+			has_lower = true;
+		}
+	}
+	void SetUpper(T constant, bool inclusive) {
+		if (!has_upper || LessThan::Operation(constant, upper) || (Equals::Operation(constant, upper) && !inclusive)) {
+			upper = constant;
+			upper_inclusive = inclusive;
+			has_upper = true;
+		}
+	}
+
+private:
+	LogicalType type;
+	vector<Value> constants;
+	bool has_lower = false;
+	T lower;
+	bool lower_inclusive = false;
+	bool has_upper = false;
+	T upper;
+	bool upper_inclusive = false;
+};
+
+template <class PRUNER>
+static void CompileFilter(PRUNER &pruner, const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (!pruner.TryAddComparison(constant_filter.comparison_type, constant_filter.constant)) {
+			pruner.has_residual = true;
+		}
+		return;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child : conjunction_and_filter.child_filters) {
+			CompileFilter(pruner, *child);
+		}
+		return;
+	}
+	case TableFilterType::OPTIONAL_FILTER: {
+		auto &optional_filter = filter.Cast<OptionalFilter>();
+		if (optional_filter.child_filter) {
+			CompileFilter(pruner, *optional_filter.child_filter);
+		}
+		return;
+	}
+	default:
+		//! IN, OR, dynamic and expression filters are left to IcebergPredicate::MatchBounds
+		pruner.has_residual = true;
+		return;
+	}
+}
+
+template <class DECODER>
+static unique_ptr<IcebergColumnPruner> CompileColumnTemplated(const TableFilter &filter, const LogicalType &type) {
+	auto result = make_uniq<TypedColumnPruner<DECODER>>(type);
+	CompileFilter(*result, filter);
+	if (!result->HasRange()) {
+		return nullptr;
+	}
+	return std::move(result);
+}
+
+static unique_ptr<IcebergColumnPruner> CompileColumn(const TableFilter &filter, const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE:
+		return CompileColumnTemplated<Int32BoundDecoder>(filter, type);
+	case LogicalTypeId::BIGINT:
+		return CompileColumnTemplated<Int64BoundDecoder>(filter, type);
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return CompileColumnTemplated<MicrosBoundDecoder>(filter, type);
+	case LogicalTypeId::FLOAT:
+		return CompileColumnTemplated<FloatBoundDecoder>(filter, type);
+	case LogicalTypeId::DOUBLE:
+		return CompileColumnTemplated<DoubleBoundDecoder>(filter, type);
+	case LogicalTypeId::VARCHAR:
+		return CompileColumnTemplated<StringBoundDecoder>(filter, type);
+	default:
+		//! i.e. decimals are serialized big-endian, these use the generic path
+		return nullptr;
+	}
+}
+
+unique_ptr<IcebergPruningProgram> IcebergPruningProgram::Compile(const TableFilterSet &filters,
+                                                                 const IcebergTableSchema &schema) {
+	auto result = make_uniq<IcebergPruningProgram>();
+	auto &columns = schema.columns;
+	for (auto &entry : filters.filters) {
+		auto column_id = entry.first;
+		if (column_id >= columns.size()) {
+			continue;
+		}
+		auto pruner = CompileColumn(*entry.second, columns[column_id]->type);
+		if (pruner) {
+			result->column_pruners.emplace(column_id, std::move(pruner));
+		}
+	}
+	return result;
+}
+
+optional_ptr<const IcebergColumnPruner> IcebergPruningProgram::GetColumnPruner(idx_t column_id) const {
+	auto it = column_pruners.find(column_id);
+	if (it == column_pruners.end()) {
+		return nullptr;
+	}
+	return it->second.get();
+}
+
+} // namespace duckdb
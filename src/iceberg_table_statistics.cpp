@@ -0,0 +1,150 @@
+#include "iceberg_table_statistics.hpp"
+#include "iceberg_multi_file_list.hpp"
+#include "iceberg_manifest.hpp"
+#include "iceberg_manifest_entry_store.hpp"
+#include "iceberg_utils.hpp"
+#include "manifest_reader.hpp"
+#include "iceberg_value.hpp"
+
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+IcebergTableStatistics::IcebergTableStatistics(const IcebergTableSchema &schema) {
+	for (auto &column : schema.columns) {
+		types.push_back(column->type);
+		field_ids.push_back(column->id);
+		names.push_back(column->name);
+	}
+	columns.resize(types.size());
+}
+
+bool IcebergTableStatistics::IsEnabled(ClientContext &context) {
+	Value result;
+	(void)context.TryGetCurrentSetting(COLUMN_STATISTICS_CONFIG_VARIABLE, result);
+	return !result.IsNull() && result.GetValue<bool>();
+}
+
+bool IcebergTableStatistics::SupportsBounds(const LogicalType &type) {
+	//! Strings are left out, their bounds can be truncated (and don't say anything about the length or unicode)
+	//! Floating points are left out, their bounds don't account for NaN
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	default:
+		return false;
+	}
+}
+
+string IcebergTableStatistics::GetCacheKey(const IcebergSnapshot &snapshot, const IcebergTableSchema &schema) {
+	return ObjectType() + ":" + snapshot.manifest_list + ":" + to_string(schema.schema_id);
+}
+
+shared_ptr<IcebergTableStatistics> IcebergTableStatistics::TryGet(ClientContext &context,
+                                                                  const IcebergSnapshot &snapshot,
+                                                                  const IcebergTableSchema &schema) {
+	auto &object_cache = ObjectCache::GetObjectCache(context);
+	return object_cache.Get<IcebergTableStatistics>(GetCacheKey(snapshot, schema));
+}
+
+shared_ptr<IcebergTableStatistics> IcebergTableStatistics::Get(ClientContext &context,
+                                                               const IcebergMultiFileList &multi_file_list) {
+	auto &snapshot = *multi_file_list.GetSnapshot();
+	auto &schema = multi_file_list.GetSchema();
+	auto cached = TryGet(context, snapshot, schema);
+	if (cached) {
+		return cached;
+	}
+	auto result = make_shared_ptr<IcebergTableStatistics>(schema);
+	result->Compute(multi_file_list);
+	ObjectCache::GetObjectCache(context).Put(GetCacheKey(snapshot, schema), result);
+	return result;
+}
+
+static void UpdateBound(Value &current, const Value &bound, bool is_lower) {
+	if (current.IsNull()) {
+		current = bound;
+		return;
+	}
+	if (is_lower ? bound < current : bound > current) {
+		current = bound;
+	}
+}
+
+void IcebergTableStatistics::Compute(const IcebergMultiFileList &multi_file_list) {
+	vector<IcebergManifest> data_manifests;
+	for (auto &manifest : multi_file_list.ReadManifestList()) {
+		if (manifest.content == IcebergManifestContentType::DELETE) {
+			has_deletes = true;
+			continue;
+		}
+		data_manifests.push_back(std::move(manifest));
+	}
+
+	unordered_set<int32_t> metrics_field_ids(field_ids.begin(), field_ids.end());
+	IcebergManifestEntryStore entries;
+	multi_file_list.ReadDataFileMetrics(data_manifests, metrics_field_ids, entries);
+
+	for (idx_t entry_idx = 0; entry_idx < entries.Count(); entry_idx++) {
+		record_count += NumericCast<idx_t>(entries.GetRecordCount(entry_idx));
+		for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+			auto &column = columns[col_idx];
+			auto metrics = entries.GetMetrics(entry_idx, field_ids[col_idx]);
+			if (!metrics || metrics->null_value_count < 0) {
+				column.has_null_count = false;
+			} else {
+				column.null_count += NumericCast<idx_t>(metrics->null_value_count);
+			}
+			if (!column.has_bounds) {
+				continue;
+			}
+			bool has_bounds = SupportsBounds(types[col_idx]) && metrics && metrics->has_lower_bound &&
+			                  metrics->has_upper_bound;
+			if (has_bounds) {
+				auto &type = types[col_idx];
+				auto lower = IcebergValue::DeserializeValue(metrics->lower_bound, type);
+				auto upper = IcebergValue::DeserializeValue(metrics->upper_bound, type);
+				//! Statistics are only a hint, a bound we can't read is treated like a missing bound
+				has_bounds = !lower.HasError() && !upper.HasError();
+				if (has_bounds) {
+					UpdateBound(column.min, lower.GetValue(), true);
+					UpdateBound(column.max, upper.GetValue(), false);
+				}
+			}
+			if (!has_bounds) {
+				//! A file without bounds can contain any value
+				column.has_bounds = false;
+				column.min = Value();
+				column.max = Value();
+			}
+		}
+	}
+}
+
+unique_ptr<BaseStatistics> IcebergTableStatistics::GetColumnStatistics(idx_t column_index) const {
+	if (column_index >= columns.size()) {
+		return nullptr;
+	}
+	auto &column = columns[column_index];
+	auto &type = types[column_index];
+	auto result = BaseStatistics::CreateUnknown(type);
+	if (column.has_bounds && !column.min.IsNull() && !column.max.IsNull()) {
+		NumericStats::SetMin(result, column.min);
+		NumericStats::SetMax(result, column.max);
+	}
+	if (column.has_null_count && column.null_count == 0) {
+		result.Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+	}
+	return result.ToUnique();
+}
+
+} // namespace duckdb
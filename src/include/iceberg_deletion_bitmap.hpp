@@ -0,0 +1,73 @@
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! A set of deleted row positions, organized like a roaring bitmap:
+//! the positions are split on their upper bits into containers of 2^16 rows, a container holds the lower 16 bits
+//! either as a sorted array (sparse) or as a bitmap of 1024 words (dense)
+class IcebergDeletionBitmap {
+public:
+	static constexpr idx_t CONTAINER_BITS = 16;
+	static constexpr idx_t CONTAINER_SIZE = idx_t(1) << CONTAINER_BITS;
+	static constexpr idx_t BITMAP_WORDS = CONTAINER_SIZE / 64;
+	//! An array container is converted to a bitmap once it would take up more space than the bitmap
+	static constexpr idx_t MAX_ARRAY_SIZE = 4096;
+
+public:
+	IcebergDeletionBitmap() {
+	}
+
+public:
+	void Add(uint64_t position);
+	//! Add the positions of a bitmap of 2^16 rows, 'words' has to be BITMAP_WORDS long
+	void AddBitmap(uint64_t high_bits, const uint64_t *words);
+	//! Add all positions of another bitmap
+	void Merge(const IcebergDeletionBitmap &other);
+	//! Add the positions of a 'deletion-vector-v1' blob (of a puffin file)
+	void AddDeletionVector(const_data_ptr_t blob, idx_t size);
+	//! Sort and deduplicate the array containers, has to be called before the bitmap is read
+	void Finalize();
+	bool Contains(uint64_t position) const;
+	//! The amount of deleted positions
+	idx_t Cardinality() const;
+	//! Whether none of the rows in [start, start + count) are deleted
+	bool IsEmpty(uint64_t start, idx_t count) const;
+	//! Select the rows of [start, start + count) that are not deleted, returns the amount selected
+	idx_t Select(uint64_t start, idx_t count, SelectionVector &result) const;
+
+private:
+	struct Container {
+	public:
+		explicit Container(uint64_t high_bits) : high_bits(high_bits) {
+		}
+
+	public:
+		bool IsBitmap() const {
+			return !bitmap.empty();
+		}
+		void ConvertToBitmap();
+
+	public:
+		uint64_t high_bits;
+		//! The sorted (after Finalize) lower bits of the positions, if this is an array container
+		vector<uint16_t> array;
+		//! The bits of the positions, if this is a bitmap container
+		vector<uint64_t> bitmap;
+		bool sorted = true;
+	};
+
+private:
+	Container &GetOrCreateContainer(uint64_t high_bits);
+	optional_ptr<const Container> FindContainer(uint64_t high_bits) const;
+
+private:
+	//! The containers, sorted by their 'high_bits'
+	vector<Container> containers;
+	bool finalized = true;
+};
+
+} // namespace duckdb
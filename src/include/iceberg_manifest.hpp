@@ -6,6 +6,8 @@
 #include "duckdb/common/column_index.hpp"
 #include "duckdb/common/types/string_type.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "iceberg_manifest_cache.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
 
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
@@ -20,21 +22,46 @@ namespace duckdb {
 
 class AvroScan {
 public:
-	AvroScan(const string &scan_name, ClientContext &context, const string &path);
+	//! 'file_size' is the size of the file in bytes if it's known (0 otherwise)
+	AvroScan(const string &scan_name, ClientContext &context, const string &path, idx_t file_size = 0);
 
 public:
+	//! Initialize the scan, only the provided columns are read (all columns when 'column_indexes' is empty)
+	void InitializeScan(vector<ColumnIndex> column_indexes = vector<ColumnIndex>());
 	bool GetNext(DataChunk &chunk);
 	void InitializeChunk(DataChunk &chunk);
 	bool Finished() const;
 
+private:
+	void Bind();
+	vector<LogicalType> GetScanTypes() const;
+	//! Look up the entry in the disk cache, if it's enabled
+	shared_ptr<IcebergCachedAvroFile> LookupCache(const string &key);
+	void StoreCache(const string &key, shared_ptr<IcebergCachedAvroFile> entry);
+
 public:
-	optional_ptr<TableFunction> avro_scan;
+	TableFunction avro_scan;
 	ClientContext &context;
+	string scan_name;
+	string path;
+	idx_t file_size;
 	unique_ptr<FunctionData> bind_data;
 	unique_ptr<GlobalTableFunctionState> global_state;
 	unique_ptr<LocalTableFunctionState> local_state;
 	vector<LogicalType> return_types;
 	vector<string> return_names;
+	//! The columns that are scanned, these make up the columns of the produced chunk
+	vector<ColumnIndex> column_indexes;
+
+	optional_ptr<IcebergManifestDiskCache> disk_cache;
+	//! The size up to which the decoded rows are buffered, larger manifests can't be stored by the disk cache
+	idx_t buffer_limit = 0;
+	string cache_key;
+	//! Set when the scanned columns are served from the cache
+	shared_ptr<ColumnDataCollection> cached_data;
+	ColumnDataScanState cached_scan_state;
+	//! The rows decoded by this scan, added to the cache once the scan is finished
+	shared_ptr<ColumnDataCollection> cache_data;
 
 	bool finished = false;
 };
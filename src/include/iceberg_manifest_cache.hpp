@@ -0,0 +1,151 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// iceberg_manifest_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/storage/object_cache.hpp"
+#include "iceberg_manifest_entry_store.hpp"
+#include "iceberg_types.hpp"
+
+namespace duckdb {
+
+//! The decoded entries of a manifest or manifest list, only the member for the kind of file is set
+struct IcebergCachedManifest {
+public:
+	IcebergCachedManifest() {
+	}
+
+public:
+	idx_t GetMemoryUsage() const;
+
+public:
+	//! The manifests of a manifest list
+	vector<IcebergManifest> manifests;
+	//! The live entries of a data manifest, with the metrics of every column
+	IcebergManifestEntryStore data_files;
+	//! The live entries of a delete manifest, only the bounds of the 'file_path' column are kept
+	vector<IcebergManifestEntry> delete_files;
+};
+
+//! Database-wide cache of decoded manifests and manifest lists by path, bounded by a memory budget
+//! Manifests and manifest lists are immutable once written, so an entry never has to be invalidated
+class IcebergManifestCache : public ObjectCacheEntry {
+public:
+	static constexpr const char *CACHE_KEY = "iceberg_manifest_cache";
+
+public:
+	//! Get the cache of the database instance
+	static IcebergManifestCache &Get(ClientContext &context);
+	//! Get the configured memory budget of the cache, 0 if the cache is disabled
+	static idx_t GetMemoryLimit(ClientContext &context);
+	static idx_t ParseMemoryLimit(const string &limit);
+	//! Read the manifests of a manifest list, from the cache if it's cached
+	static vector<IcebergManifest> ReadManifestList(ClientContext &context, const string &path, idx_t iceberg_version);
+
+public:
+	shared_ptr<IcebergCachedManifest> Get(const string &key);
+	//! Add the entry, evicting the least recently used entries to stay within 'memory_limit'
+	void Put(const string &key, shared_ptr<IcebergCachedManifest> entry, idx_t memory_limit);
+	idx_t GetMemoryUsage();
+
+public:
+	static string ObjectType() {
+		return "iceberg_manifest_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct CacheEntry {
+		shared_ptr<IcebergCachedManifest> manifest;
+		idx_t memory_usage;
+		list<string>::iterator lru_position;
+	};
+
+private:
+	void Evict(idx_t memory_limit);
+
+private:
+	mutex lock;
+	unordered_map<string, CacheEntry> entries;
+	//! The least recently used entry is at the back
+	list<string> lru;
+	idx_t memory_usage = 0;
+};
+
+//! The decoded rows of an Avro file (manifest or manifest list), as stored by the disk cache
+struct IcebergCachedAvroFile {
+public:
+	IcebergCachedAvroFile(vector<LogicalType> types, vector<string> names)
+	    : types(std::move(types)), names(std::move(names)) {
+	}
+
+public:
+	//! The schema of the file
+	vector<LogicalType> types;
+	vector<string> names;
+	//! The decoded rows of the scanned columns, not set for an entry that only caches the schema
+	shared_ptr<ColumnDataCollection> data;
+};
+
+//! Optional on-disk cache of decoded Avro files, persisted across restarts
+//! An entry is stored in a compact binary file keyed by the file path (and the scanned columns) and its size, bounded
+//! by a disk quota
+class IcebergManifestDiskCache : public ObjectCacheEntry {
+public:
+	static constexpr const char *CACHE_KEY = "iceberg_manifest_disk_cache";
+
+public:
+	//! Get the disk cache of the database instance, or nullptr if no cache directory is configured
+	static optional_ptr<IcebergManifestDiskCache> TryGet(ClientContext &context);
+	//! Get the configured disk quota of the cache
+	static idx_t GetDiskQuota(ClientContext &context);
+
+public:
+	//! Read the entry, returns nullptr if it's not cached (or the cached entry is not for a file of 'source_size')
+	shared_ptr<IcebergCachedAvroFile> Read(ClientContext &context, const string &key, idx_t source_size);
+	//! Write the entry, removing the least recently used entries to stay within the disk quota
+	void Write(ClientContext &context, const string &key, idx_t source_size, const IcebergCachedAvroFile &file);
+
+public:
+	static string ObjectType() {
+		return "iceberg_manifest_disk_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	string GetEntryPath(FileSystem &fs, const string &key) const;
+	//! Scan the cache directory for the existing entries (once)
+	void Initialize(FileSystem &fs);
+	void Evict(FileSystem &fs, idx_t disk_quota);
+	//! Start tracking an entry in the directory as the most recently used one
+	void Track(const string &path, idx_t size);
+	//! Mark a tracked entry as the most recently used one
+	void Touch(const string &path);
+	//! Stop tracking an entry that is removed from the directory
+	void Untrack(const string &path);
+
+private:
+	mutex lock;
+	bool initialized = false;
+	string directory;
+	//! The entries in the directory with their size, the least recently used entry is at the front
+	list<pair<string, idx_t>> files;
+	//! The position of every tracked entry in 'files'
+	unordered_map<string, list<pair<string, idx_t>>::iterator> file_positions;
+	idx_t disk_usage = 0;
+};
+
+} // namespace duckdb
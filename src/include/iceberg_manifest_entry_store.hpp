@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// iceberg_manifest_entry_store.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "iceberg_types.hpp"
+#include "duckdb/common/types/string_heap.hpp"
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
+
+namespace duckdb {
+
+//! The metrics of a single column of a data file, the bounds are (binary single-value serialized) blobs
+struct IcebergColumnMetrics {
+public:
+	explicit IcebergColumnMetrics(int32_t field_id) : field_id(field_id) {
+	}
+
+public:
+	int32_t field_id;
+	bool has_lower_bound = false;
+	bool has_upper_bound = false;
+	string_t lower_bound;
+	string_t upper_bound;
+	//! -1 if the count is not present
+	int64_t value_count = -1;
+	int64_t null_value_count = -1;
+	int64_t nan_value_count = -1;
+};
+
+//! Columnar storage for the (data) manifest entries of a scan
+//! Every field is stored in its own array, strings and bounds live in a shared string heap
+//! The metrics of an entry are a range of 'metrics', the partition is an index into the deduplicated 'partitions'
+class IcebergManifestEntryStore {
+public:
+	IcebergManifestEntryStore();
+	IcebergManifestEntryStore(const IcebergManifestEntryStore &) = delete;
+	IcebergManifestEntryStore &operator=(const IcebergManifestEntryStore &) = delete;
+	IcebergManifestEntryStore(IcebergManifestEntryStore &&) = default;
+	IcebergManifestEntryStore &operator=(IcebergManifestEntryStore &&) = default;
+
+public:
+	idx_t Count() const {
+		return file_paths.size();
+	}
+	//! Append an entry, returns the index of the entry
+	idx_t Append(const string_t &file_path, const string_t &file_format, int64_t record_count,
+	             int64_t file_size_in_bytes, sequence_number_t sequence_number, int32_t partition_spec_id,
+	             const Value &partition);
+	//! Append the entry of 'other', returns its index
+	//! The metrics of the 'field_ids' (all metrics when empty) are copied along if 'copy_metrics' is set
+	idx_t Append(const IcebergManifestEntryStore &other, idx_t index, bool copy_metrics,
+	             const unordered_set<int32_t> &field_ids);
+	//! Add the metrics of a column to the last appended entry, returns the index of the metrics
+	idx_t AppendMetrics(int32_t field_id);
+	IcebergColumnMetrics &GetAppendedMetrics(idx_t metrics_index) {
+		return metrics[metrics_index];
+	}
+	//! Add a bound (blob) to the heap of the store
+	string_t AddBound(const string_t &bound);
+	//! Move all the entries of 'other' to the end of this store
+	void Merge(IcebergManifestEntryStore &other);
+	//! Rough estimate of the memory that is held on to by the store
+	idx_t GetMemoryUsage() const;
+
+public:
+	const string_t &GetFilePath(idx_t index) const {
+		return file_paths[index];
+	}
+	const string_t &GetFileFormat(idx_t index) const {
+		return file_formats[index];
+	}
+	int64_t GetRecordCount(idx_t index) const {
+		return record_counts[index];
+	}
+	int64_t GetFileSizeInBytes(idx_t index) const {
+		return file_sizes_in_bytes[index];
+	}
+	sequence_number_t GetSequenceNumber(idx_t index) const {
+		return sequence_numbers[index];
+	}
+	int32_t GetPartitionSpecID(idx_t index) const {
+		return partition_spec_ids[index];
+	}
+	const Value &GetPartition(idx_t index) const {
+		return partitions[partition_indexes[index]];
+	}
+	//! Get the metrics of the column for the entry, or nullptr if there are none
+	optional_ptr<const IcebergColumnMetrics> GetMetrics(idx_t index, int32_t field_id) const;
+	//! Whether the entry has a lower and an upper bound for any of its columns
+	bool HasBounds(idx_t index) const;
+
+private:
+	idx_t GetPartitionIndex(const Value &partition);
+	//! The end of the range of 'metrics' of the entry
+	idx_t GetMetricsEnd(idx_t index) const;
+
+private:
+	//! The heaps that the strings of the entries are stored in, merged stores keep their heaps alive
+	vector<unique_ptr<StringHeap>> heaps;
+
+	vector<string_t> file_paths;
+	vector<string_t> file_formats;
+	vector<int64_t> record_counts;
+	vector<int64_t> file_sizes_in_bytes;
+	vector<sequence_number_t> sequence_numbers;
+	vector<int32_t> partition_spec_ids;
+	vector<idx_t> partition_indexes;
+	//! The start of the range of 'metrics' of every entry, the range ends where the next entry's starts
+	vector<idx_t> metrics_offsets;
+
+	vector<IcebergColumnMetrics> metrics;
+	//! Every distinct partition value
+	vector<Value> partitions;
+	value_map_t<idx_t> partition_map;
+};
+
+} // namespace duckdb
@@ -47,7 +47,7 @@ public:
 	                IcebergTableSchema &schema)
 	    : metadata_path(metadata_path), metadata(metadata), snapshot(snapshot), schema(schema) {
 	}
-	IcebergScanInfo(const string &metadata_path, unique_ptr<IcebergTableMetadata> owned_metadata_p,
+	IcebergScanInfo(const string &metadata_path, shared_ptr<IcebergTableMetadata> owned_metadata_p,
 	                optional_ptr<IcebergSnapshot> snapshot, IcebergTableSchema &schema)
 	    : metadata_path(metadata_path), owned_metadata(std::move(owned_metadata_p)), metadata(*owned_metadata),
 	      snapshot(snapshot), schema(schema) {
@@ -55,7 +55,8 @@ public:
 
 public:
 	string metadata_path;
-	unique_ptr<IcebergTableMetadata> owned_metadata;
+	//! Set when the metadata is not owned by a catalog, it can be shared with other scans through the metadata cache
+	shared_ptr<IcebergTableMetadata> owned_metadata;
 	IcebergTableMetadata &metadata;
 	optional_ptr<IcebergSnapshot> snapshot;
 	IcebergTableSchema &schema;
@@ -10,55 +10,82 @@
 
 #include "duckdb/common/multi_file/multi_file_list.hpp"
 #include "duckdb/common/types/batched_data_collection.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "iceberg_deletion_bitmap.hpp"
 #include "iceberg_metadata.hpp"
+#include "iceberg_table_statistics.hpp"
 #include "iceberg_utils.hpp"
 #include "manifest_reader.hpp"
 #include "duckdb/common/multi_file/multi_file_data.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/error_data.hpp"
 #include "duckdb/common/list.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/parallel/task_executor.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
-struct IcebergEqualityDeleteRow {
+struct IcebergEqualityDeleteFile {
 public:
-	IcebergEqualityDeleteRow() {
+	IcebergEqualityDeleteFile(sequence_number_t sequence_number, Value partition, int32_t partition_spec_id,
+	                          vector<int32_t> equality_ids)
+	    : sequence_number(sequence_number), partition(partition), partition_spec_id(partition_spec_id),
+	      equality_ids(std::move(equality_ids)) {
 	}
-	IcebergEqualityDeleteRow(const IcebergEqualityDeleteRow &) = delete;
-	IcebergEqualityDeleteRow &operator=(const IcebergEqualityDeleteRow &) = delete;
-	IcebergEqualityDeleteRow(IcebergEqualityDeleteRow &&) = default;
-	IcebergEqualityDeleteRow &operator=(IcebergEqualityDeleteRow &&) = default;
-
-public:
-	//! Map of field-id to equality delete for the field
-	//! NOTE: these are either OPERATOR_IS_NULL or COMPARE_EQUAL
-	//! Also note: it's probably easiest to apply these to the 'output_chunk' of FinalizeChunk, so we can re-use
-	//! expressions. Otherwise the idx of the BoundReferenceExpression would have to change for every file.
-	unordered_map<int32_t, unique_ptr<Expression>> filters;
-};
 
-struct IcebergEqualityDeleteFile {
 public:
-	IcebergEqualityDeleteFile(Value partition, int32_t partition_spec_id)
-	    : partition(partition), partition_spec_id(partition_spec_id) {
-	}
+	//! Hash the values of the equality columns, the deleted rows and the scanned rows are hashed the same way
+	static void HashKeys(vector<Vector> &keys, idx_t count, Vector &hashes);
+	//! Add the equality columns of a chunk of the delete file, hashed with 'HashKeys'
+	void Append(Allocator &allocator, vector<Vector> &key_columns, idx_t count, Vector &hashes);
+	//! Called once the delete file is scanned, gathers the collected keys into one vector per equality column
+	void Finalize();
+	//! Remove the rows in 'sel' (of the equality columns of a scanned chunk) that are deleted by this file
+	//! Returns the number of rows that are left in 'sel'
+	idx_t Filter(vector<Vector> &key_columns, const hash_t *hashes, SelectionVector &sel, idx_t count) const;
 
 public:
+	//! The deletes apply to the data files with a lower sequence number
+	sequence_number_t sequence_number;
 	//! The partition value (struct) if the equality delete has partition information
 	Value partition;
 	int32_t partition_spec_id;
-	vector<IcebergEqualityDeleteRow> rows;
+	//! The field ids of the equality columns
+	vector<int32_t> equality_ids;
+	//! The index of each equality column in the 'global_columns', its values are cast to the type of that column
+	vector<column_t> column_indexes;
+	//! The number of deleted rows
+	idx_t row_count = 0;
+	//! The keys collected while the delete file is scanned, moved into 'keys' by Finalize
+	unique_ptr<ColumnDataCollection> collection;
+	//! The values of the equality columns of the deleted rows, in the order of the 'equality_ids'
+	//! NOTE: a NULL value deletes the rows where the column is NULL
+	vector<Vector> keys;
+	//! The last added row with a hash, the rows with the same hash are chained through 'next_row'
+	unordered_map<hash_t, idx_t> hash_to_row;
+	vector<idx_t> next_row;
 };
 
+//! The equality delete files of a partition
 struct IcebergEqualityDeleteData {
 public:
-	IcebergEqualityDeleteData(sequence_number_t sequence_number) : sequence_number(sequence_number) {
+	IcebergEqualityDeleteData() {
+	}
+
+public:
+	//! The key of a partition in the index of the equality deletes
+	static hash_t GetPartitionHash(int32_t partition_spec_id, const Value &partition) {
+		return CombineHash(Hash(partition_spec_id), partition.Hash());
 	}
 
 public:
-	sequence_number_t sequence_number;
 	vector<IcebergEqualityDeleteFile> files;
 };
 
@@ -69,7 +96,11 @@ public:
 
 public:
 	void AddRow(int64_t row_id) {
-		temp_invalid_rows.insert(row_id);
+		deleted_rows.Add(NumericCast<uint64_t>(row_id));
+	}
+	//! Called once all the deletes for the file are added, before the data file is scanned
+	void Finalize() {
+		deleted_rows.Finalize();
 	}
 
 	idx_t Filter(row_t start_row_index, idx_t count, SelectionVector &result_sel) override {
@@ -77,24 +108,174 @@ public:
 			return 0;
 		}
 		result_sel.Initialize(STANDARD_VECTOR_SIZE);
-		idx_t selection_idx = 0;
-		for (idx_t i = 0; i < count; i++) {
-			if (!temp_invalid_rows.count(i + start_row_index)) {
-				result_sel.set_index(selection_idx++, i);
+		auto start = NumericCast<uint64_t>(start_row_index);
+		if (deleted_rows.IsEmpty(start, count)) {
+			//! Nothing deleted in this vector, no need to look at the individual rows
+			for (idx_t i = 0; i < count; i++) {
+				result_sel.set_index(i, i);
 			}
+			return count;
+		}
+		return deleted_rows.Select(start, count, result_sel);
+	}
+
+public:
+	//! The positions of the deleted rows
+	IcebergDeletionBitmap deleted_rows;
+};
+
+//! A positional delete file with bounds on the 'file_path' column, it's scanned once a data file within its bounds is
+//! scanned
+struct IcebergPositionalDeleteFile {
+public:
+	IcebergPositionalDeleteFile(IcebergManifestEntry entry, string lower_bound, string upper_bound)
+	    : entry(std::move(entry)), lower_bound(std::move(lower_bound)), upper_bound(std::move(upper_bound)) {
+	}
+
+public:
+	IcebergManifestEntry entry;
+	//! The bounds on the paths of the data files that the deletes of this file apply to
+	string lower_bound;
+	string upper_bound;
+	//! Protects 'loaded', held while the file is scanned so the file is scanned once
+	mutex lock;
+	bool loaded = false;
+};
+
+//! The equality deletes that apply to a data file, resolved once when the data file is bound
+struct IcebergEqualityDeleteFilter {
+public:
+	struct DeleteFile {
+	public:
+		explicit DeleteFile(const IcebergEqualityDeleteFile &file) : file(file) {
+		}
+
+	public:
+		reference<const IcebergEqualityDeleteFile> file;
+		//! Whether each equality column is present in the data file, a missing column is treated as NULL
+		vector<bool> column_present;
+	};
+
+public:
+	//! Remove the deleted rows from a chunk of the global columns
+	void Filter(DataChunk &chunk) const;
+
+public:
+	vector<DeleteFile> files;
+};
+
+//! The deletes of a data file with equality deletes, set as the 'deletion_filter' of its reader
+//! The positional deletes are applied by the reader, the equality deletes are applied in FinalizeChunk
+struct IcebergDeleteFilter : public DeleteFilter {
+public:
+	IcebergDeleteFilter(unique_ptr<IcebergPositionalDeleteData> positional_deletes,
+	                    unique_ptr<IcebergEqualityDeleteFilter> equality_deletes)
+	    : positional_deletes(std::move(positional_deletes)), equality_deletes(std::move(equality_deletes)) {
+	}
+
+public:
+	idx_t Filter(row_t start_row_index, idx_t count, SelectionVector &result_sel) override {
+		if (positional_deletes) {
+			return positional_deletes->Filter(start_row_index, count, result_sel);
+		}
+		result_sel.Initialize(STANDARD_VECTOR_SIZE);
+		for (idx_t i = 0; i < count; i++) {
+			result_sel.set_index(i, i);
 		}
-		return selection_idx;
+		return count;
 	}
 
 public:
-	//! Store invalid rows here before finalizing into a SelectionVector
-	unordered_set<int64_t> temp_invalid_rows;
+	//! nullptr if the data file has no positional deletes
+	unique_ptr<IcebergPositionalDeleteData> positional_deletes;
+	unique_ptr<IcebergEqualityDeleteFilter> equality_deletes;
+};
+
+struct IcebergMultiFileList;
+
+enum class IcebergManifestReadState : uint8_t { PENDING, RUNNING, FINISHED, CANCELLED };
+
+//! A data manifest that is read ahead of the scan
+struct IcebergManifestPrefetch {
+public:
+	explicit IcebergManifestPrefetch(const IcebergManifest &manifest) : manifest(manifest) {
+	}
+
+public:
+	//! Claim the read of the manifest, returns false if another thread already claimed it
+	bool TryClaim();
+	//! Mark the read as finished (successfully or not), waking up the waiting thread
+	void Finish(ErrorData error = ErrorData());
+	//! Mark the read as cancelled if it was not claimed yet
+	void Cancel();
+	//! Wait for the read to finish, rethrowing the error if it failed
+	void Wait();
+
+public:
+	const IcebergManifest &manifest;
+	//! If set, all the entries are read with the metrics of these fields (instead of those matching the filters)
+	optional_ptr<const unordered_set<int32_t>> metrics_field_ids;
+	//! The entries of the manifest that match the pushed down filters
+	IcebergManifestEntryStore entries;
+
+private:
+	mutex lock;
+	std::condition_variable finished;
+	IcebergManifestReadState state = IcebergManifestReadState::PENDING;
+	ErrorData error;
+};
+
+//! Reads a single data manifest, used to read manifests ahead of the scan on the TaskScheduler
+class IcebergManifestReadTask : public BaseExecutorTask {
+public:
+	IcebergManifestReadTask(TaskExecutor &executor, const IcebergMultiFileList &multi_file_list,
+	                        shared_ptr<IcebergManifestPrefetch> prefetch);
+
+public:
+	void ExecuteTask() override;
+
+private:
+	const IcebergMultiFileList &multi_file_list;
+	shared_ptr<IcebergManifestPrefetch> prefetch;
+};
+
+//! Reads a delete manifest, scheduling the scans of its delete files on the same executor
+class IcebergDeleteManifestReadTask : public BaseExecutorTask {
+public:
+	IcebergDeleteManifestReadTask(TaskExecutor &executor, const IcebergMultiFileList &multi_file_list,
+	                              const IcebergManifest &manifest,
+	                              shared_ptr<const vector<MultiFileColumnDefinition>> global_columns);
+
+public:
+	void ExecuteTask() override;
+
+private:
+	const IcebergMultiFileList &multi_file_list;
+	const IcebergManifest &manifest;
+	shared_ptr<const vector<MultiFileColumnDefinition>> global_columns;
+};
+
+//! Scans a single delete file, merging its deletes into the delete data of the list
+class IcebergDeleteFileScanTask : public BaseExecutorTask {
+public:
+	IcebergDeleteFileScanTask(TaskExecutor &executor, const IcebergMultiFileList &multi_file_list,
+	                          IcebergManifestEntry entry,
+	                          shared_ptr<const vector<MultiFileColumnDefinition>> global_columns);
+
+public:
+	void ExecuteTask() override;
+
+private:
+	const IcebergMultiFileList &multi_file_list;
+	IcebergManifestEntry entry;
+	shared_ptr<const vector<MultiFileColumnDefinition>> global_columns;
 };
 
 struct IcebergMultiFileList : public MultiFileList {
 public:
 	IcebergMultiFileList(ClientContext &context, shared_ptr<IcebergScanInfo> scan_info, const string &path,
 	                     const IcebergOptions &options);
+	~IcebergMultiFileList() override;
 
 public:
 	static string ToDuckDBPath(const string &raw_path);
@@ -105,14 +286,37 @@ public:
 
 	void Bind(vector<LogicalType> &return_types, vector<string> &names);
 	unique_ptr<IcebergMultiFileList> PushdownInternal(ClientContext &context, TableFilterSet &new_filters) const;
-	void ScanPositionalDeleteFile(DataChunk &result) const;
+	void ScanPositionalDeleteFile(DataChunk &result,
+	                              case_insensitive_map_t<unique_ptr<IcebergPositionalDeleteData>> &deletes) const;
 	void ScanEqualityDeleteFile(const IcebergManifestEntry &entry, DataChunk &result,
 	                            vector<MultiFileColumnDefinition> &columns,
-	                            const vector<MultiFileColumnDefinition> &global_columns) const;
+	                            const vector<MultiFileColumnDefinition> &global_columns,
+	                            IcebergEqualityDeleteFile &delete_file) const;
 	void ScanDeleteFile(const IcebergManifestEntry &entry,
 	                    const vector<MultiFileColumnDefinition> &global_columns) const;
 	unique_ptr<IcebergPositionalDeleteData> GetPositionalDeletesForFile(const string &file_path) const;
+	//! Take the (v3) deletion vector entry of a data file, nullptr if it has none
+	unique_ptr<IcebergManifestEntry> GetDeletionVectorForFile(const string &file_path) const;
+	//! Read the 'deletion-vector-v1' blob of the entry from its puffin file, into 'deletes'
+	void ReadDeletionVector(const IcebergManifestEntry &entry, IcebergPositionalDeleteData &deletes) const;
+	//! Resolve the equality deletes that apply to a data file, nullptr if there are none
+	unique_ptr<IcebergEqualityDeleteFilter>
+	GetEqualityDeletesForFile(sequence_number_t sequence_number, int32_t partition_spec_id, const Value &partition,
+	                          const vector<MultiFileColumnDefinition> &local_columns) const;
+	//! Load the deletes of all delete files, in parallel, the first scan that needs them owns the load
+	//! The scans that need them while they're loading wait for the owner to finish
+	//! The positional delete files with 'file_path' bounds are only indexed, see LoadPositionalDeletesForFile
 	void ProcessDeletes(const vector<MultiFileColumnDefinition> &global_columns) const;
+	//! Scan the positional delete files whose 'file_path' bounds contain the data file, if they weren't scanned yet
+	void LoadPositionalDeletesForFile(const string &file_path,
+	                                  const vector<MultiFileColumnDefinition> &global_columns) const;
+	//! Read the entries of a delete manifest and schedule the scans of its delete files
+	void ReadDeleteManifest(TaskExecutor &executor, const IcebergManifest &manifest,
+	                        shared_ptr<const vector<MultiFileColumnDefinition>> global_columns) const;
+	//! Index a positional delete file on its 'file_path' bounds, returns false if it has no bounds
+	bool IndexPositionalDeleteFile(IcebergManifestEntry &entry) const;
+	//! Sort the delete files that reference a range of data files on their lower bound, once all are indexed
+	void SortRangedPositionalDeletes() const;
 
 public:
 	//! MultiFileList API
@@ -127,16 +331,47 @@ public:
 	FileExpandResult GetExpandResult() override;
 	idx_t GetTotalFileCount() override;
 	unique_ptr<NodeStatistics> GetCardinality(ClientContext &context) override;
+	//! Get the statistics of a column of the snapshot (from the metrics of the data files)
+	unique_ptr<BaseStatistics> GetStatistics(column_t column_index);
 
 protected:
 	//! Get the i-th expanded file
 	OpenFileInfo GetFile(idx_t i) override;
 
+public:
+	//! Read all the entries of a data manifest that match the pushed down filters
+	void ReadDataManifest(const IcebergManifest &manifest, IcebergManifestEntryStore &result) const;
+	//! Read the data files of the snapshot with the metrics of 'field_ids', independent of the state of the list
+	//! Only manifests are pruned, the data files aren't filtered. Returns false if the snapshot has delete files
+	bool ReadDataFileMetrics(const unordered_set<int32_t> &field_ids, IcebergManifestEntryStore &result);
+	//! Read all the data files of 'manifests' with the metrics of 'field_ids', the manifests are read in parallel
+	void ReadDataFileMetrics(const vector<IcebergManifest> &manifests, const unordered_set<int32_t> &field_ids,
+	                         IcebergManifestEntryStore &result) const;
+	//! Read a claimed data manifest, recording any error on the prefetch
+	void ReadDataManifest(IcebergManifestPrefetch &prefetch) const;
+	//! Read the manifest list of the snapshot (through the manifest cache)
+	vector<IcebergManifest> ReadManifestList() const;
+
 protected:
+	//! Set the pushed down filters (and the skipped files) on the reader of a data manifest
+	void ConfigureDataManifestReader(const IcebergManifest &manifest, ManifestFileReader &manifest_reader) const;
+	//! Get the entries of a data manifest from the manifest cache, reading them into the cache if they're not cached
+	//! Returns nullptr if the cache is disabled
+	shared_ptr<IcebergCachedManifest> GetCachedDataManifest(const IcebergManifest &manifest,
+	                                                        const string &full_path) const;
+	//! Read all the entries of a data manifest with the metrics of 'field_ids'
+	void ReadDataManifestMetrics(const IcebergManifest &manifest, const unordered_set<int32_t> &field_ids,
+	                             IcebergManifestEntryStore &result) const;
+
 	bool ManifestMatchesFilter(IcebergManifest &manifest);
-	bool FileMatchesFilter(IcebergManifestEntry &file);
+	//! Get the amount of data files from the counters in the manifest list, if they are present and no filters apply
+	bool TryGetManifestFileCount(idx_t &result) const;
 	// TODO: How to guarantee we only call this after the filter pushdown?
 	void InitializeFiles(lock_guard<mutex> &guard);
+	//! Schedule reads for the data manifests following the current one, up to the prefetch count
+	void PrefetchDataManifests();
+	//! Append the entries of the current data manifest to 'data_files', reading it if it wasn't prefetched
+	void ExpandDataManifest();
 
 public:
 	ClientContext &context;
@@ -149,22 +384,56 @@ public:
 	vector<string> names;
 	vector<LogicalType> types;
 	TableFilterSet table_filters;
+	//! The 'table_filters', compiled to prune data files on their raw bounds
+	unique_ptr<IcebergPruningProgram> pruning_program;
+	//! The column index (in the schema) of a field id, to find the filter of a partition field's source
+	unordered_map<uint64_t, idx_t> source_to_column_id;
+
+	//! The manifests of the list this list was pushed down from, used instead of reading the manifest list again
+	shared_ptr<const vector<IcebergManifest>> parent_manifests;
 
-	unique_ptr<ManifestListReader> manifest_list;
-	unique_ptr<ManifestFileReader> data_manifest_reader;
-	unique_ptr<ManifestFileReader> delete_manifest_reader;
+	//! The data files that are not scanned (because their contribution is answered from the metadata)
+	shared_ptr<const unordered_set<string>> skipped_data_files;
+	//! The (lazily computed) column statistics of the snapshot
+	shared_ptr<IcebergTableStatistics> statistics;
 
-	vector<IcebergManifestEntry> data_files;
+	IcebergManifestEntryStore data_files;
 	vector<IcebergManifest> data_manifests;
 	vector<IcebergManifest> delete_manifests;
 	vector<IcebergManifest>::iterator current_data_manifest;
-	mutable vector<IcebergManifest>::iterator current_delete_manifest;
+	//! The amount of data manifests to read ahead of 'current_data_manifest'
+	idx_t prefetch_count = 0;
+	//! The (scheduled) reads for the data manifests starting at 'current_data_manifest'
+	deque<shared_ptr<IcebergManifestPrefetch>> prefetched_manifests;
+	unique_ptr<TaskExecutor> prefetch_executor;
 
 	//! For each file that has a delete file, the state for processing that/those delete file(s)
 	mutable case_insensitive_map_t<unique_ptr<IcebergPositionalDeleteData>> positional_delete_data;
+	//! The deletion vectors (v3), by the data file they reference
+	mutable case_insensitive_map_t<IcebergManifestEntry> deletion_vectors;
+	//! The positional delete files that are scanned lazily (see LoadPositionalDeletesForFile)
+	mutable vector<unique_ptr<IcebergPositionalDeleteFile>> positional_delete_files;
+	//! The index in 'positional_delete_files' of the files that only reference a single data file, by its path
+	mutable unordered_map<string, vector<idx_t>> single_file_positional_deletes;
+	//! The index in 'positional_delete_files' of the files that reference a range of data files
+	//! Sorted on the lower bound once the deletes are loaded
+	mutable vector<idx_t> ranged_positional_deletes;
+	//! For each entry of 'ranged_positional_deletes', the highest upper bound of the files up to (and including) it
+	mutable vector<string> ranged_positional_deletes_max_upper;
+	//! The equality delete files of partitioned specs, by the hash of their partition spec id and partition
 	//! All equality deletes with sequence numbers higher than that of the data_file apply to that data_file
-	mutable map<sequence_number_t, unique_ptr<IcebergEqualityDeleteData>> equality_delete_data;
+	mutable unordered_map<hash_t, IcebergEqualityDeleteData> partitioned_equality_deletes;
+	//! The equality delete files of unpartitioned specs, these apply to the data files of every partition
+	mutable IcebergEqualityDeleteData unpartitioned_equality_deletes;
+	//! Protects the delete data while it's being loaded, and the start of the load
 	mutable mutex delete_lock;
+	//! Runs the delete manifest reads and delete file scans, created by the scan that owns the load
+	mutable unique_ptr<TaskExecutor> delete_executor;
+	//! Set once all delete files are loaded, the delete data no longer changes after that
+	mutable atomic<bool> deletes_loaded {false};
+	//! Signalled when the owner of the load finished, successfully ('deletes_loaded') or not ('delete_error')
+	mutable std::condition_variable deletes_finished;
+	mutable ErrorData delete_error;
 
 	bool initialized = false;
 	const IcebergOptions &options;
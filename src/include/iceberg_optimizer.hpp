@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// iceberg_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+
+//! Answers COUNT/MIN/MAX aggregates over an iceberg_scan from the metrics in the manifests
+//! The data files that can't be answered exactly are still scanned, the results of both are combined
+class IcebergOptimizer {
+public:
+	static OptimizerExtension GetOptimizerExtension();
+	static void Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
+};
+
+} // namespace duckdb
@@ -8,6 +8,30 @@ namespace duckdb {
 
 static string VERSION_GUESSING_CONFIG_VARIABLE = "unsafe_enable_version_guessing";
 
+// The amount of data manifests that are read ahead of the scan, defaults to the amount of threads when not set
+static string MANIFEST_PREFETCH_COUNT_CONFIG_VARIABLE = "iceberg_manifest_prefetch_count";
+
+// The memory budget of the (database-wide) cache of decoded manifests and manifest lists, '0' disables the cache
+static string MANIFEST_CACHE_SIZE_CONFIG_VARIABLE = "iceberg_manifest_cache_size";
+static constexpr const char *DEFAULT_MANIFEST_CACHE_SIZE = "256MB";
+
+// The maximum amount of parsed metadata.json files that are cached (per database), '0' disables the cache
+static string METADATA_CACHE_ENTRIES_CONFIG_VARIABLE = "iceberg_metadata_cache_entries";
+static constexpr const idx_t DEFAULT_METADATA_CACHE_ENTRIES = 32;
+
+// The directory of the (persistent) on-disk cache of decoded manifests, the disk cache is disabled when not set
+static string MANIFEST_DISK_CACHE_DIRECTORY_CONFIG_VARIABLE = "iceberg_manifest_disk_cache_directory";
+// The disk quota of the on-disk manifest cache
+static string MANIFEST_DISK_CACHE_SIZE_CONFIG_VARIABLE = "iceberg_manifest_disk_cache_size";
+static constexpr const char *DEFAULT_MANIFEST_DISK_CACHE_SIZE = "1GB";
+
+// Whether the scan provides column statistics (from the metrics of the data files) to the optimizer
+// This reads every data manifest of the snapshot while planning, so it is disabled by default
+static string COLUMN_STATISTICS_CONFIG_VARIABLE = "iceberg_column_statistics";
+
+// Whether aggregates without a GROUP BY are answered from the metrics of the data files where possible
+static string METADATA_AGGREGATES_CONFIG_VARIABLE = "iceberg_metadata_aggregates";
+
 // When this is provided (and unsafe_enable_version_guessing is true)
 // we first look for DEFAULT_VERSION_HINT_FILE, if it doesn't exist we
 // then search for versions matching the DEFAULT_TABLE_VERSION_FORMAT
@@ -10,7 +10,13 @@ public:
 	IcebergPredicate() = delete;
 
 public:
+	//! Prepare a (copied) filter for repeated evaluation against bounds, i.e. sort the values of IN filters
+	static void PrepareFilter(TableFilter &filter);
+	//! Whether a value in the bounds could match the filter, the filter has to be prepared with 'PrepareFilter'
 	static bool MatchBounds(TableFilter &filter, const IcebergPredicateStats &stats, const IcebergTransform &transform);
+	//! Whether every value of a (data file) column matches the filter, given its (exact) bounds and null/nan presence
+	//! Conservative: returns false whenever the filter could remove a row
+	static bool MatchesAllValues(TableFilter &filter, const IcebergPredicateStats &stats);
 };
 
 } // namespace duckdb
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "duckdb/common/types/string_type.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "metadata/iceberg_table_schema.hpp"
+
+namespace duckdb {
+
+//! The filter of a column, compiled to be checked against the raw (single-value serialized) bounds of a data file
+class IcebergColumnPruner {
+public:
+	virtual ~IcebergColumnPruner() {
+	}
+
+public:
+	//! Whether a value in the bounds could match the compiled part of the filter, a missing bound (nullptr) can't
+	//! rule anything out
+	virtual bool MatchBounds(const string_t *lower_bound, const string_t *upper_bound) const = 0;
+
+public:
+	//! Part of the filter could not be compiled, it has to be checked with IcebergPredicate::MatchBounds as well
+	bool has_residual = false;
+};
+
+//! The pushed down filters of a scan, compiled once so the data files are pruned without constructing Values
+class IcebergPruningProgram {
+public:
+	IcebergPruningProgram() {
+	}
+
+public:
+	static unique_ptr<IcebergPruningProgram> Compile(const TableFilterSet &filters, const IcebergTableSchema &schema);
+	//! Get the pruner of the column, nullptr if its filter could not be compiled
+	optional_ptr<const IcebergColumnPruner> GetColumnPruner(idx_t column_id) const;
+
+private:
+	unordered_map<idx_t, unique_ptr<IcebergColumnPruner>> column_pruners;
+};
+
+} // namespace duckdb
@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// iceberg_table_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "metadata/iceberg_table_metadata.hpp"
+
+#include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+struct IcebergMultiFileList;
+
+//! The statistics of a column, aggregated over the (live) data files of a snapshot
+struct IcebergColumnStatistics {
+public:
+	//! Whether every data file has (readable) bounds for the column
+	bool has_bounds = true;
+	Value min;
+	Value max;
+	//! Whether every data file has a null count for the column
+	bool has_null_count = true;
+	idx_t null_count = 0;
+};
+
+//! Column statistics of a snapshot, aggregated from the metrics ('lower_bounds', 'upper_bounds' and
+//! 'null_value_counts') of its data files
+//! The manifest list of a snapshot never changes, so the statistics are cached by the manifest list (and schema)
+class IcebergTableStatistics : public ObjectCacheEntry {
+public:
+	explicit IcebergTableStatistics(const IcebergTableSchema &schema);
+
+public:
+	//! Get (or compute) the statistics of the snapshot of the list, read with the schema of the list
+	static shared_ptr<IcebergTableStatistics> Get(ClientContext &context, const IcebergMultiFileList &multi_file_list);
+	//! Get the statistics of the snapshot if they are cached, nullptr otherwise
+	static shared_ptr<IcebergTableStatistics> TryGet(ClientContext &context, const IcebergSnapshot &snapshot,
+	                                                 const IcebergTableSchema &schema);
+	//! Whether the column statistics are enabled ('iceberg_column_statistics')
+	static bool IsEnabled(ClientContext &context);
+	//! Whether the optimizer statistics can be derived from the bounds of a column of this type
+	static bool SupportsBounds(const LogicalType &type);
+
+public:
+	//! Get the statistics of the top-level column at 'column_index' of the schema, nullptr if there are none
+	unique_ptr<BaseStatistics> GetColumnStatistics(idx_t column_index) const;
+
+public:
+	static string ObjectType() {
+		return "iceberg_table_statistics";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	static string GetCacheKey(const IcebergSnapshot &snapshot, const IcebergTableSchema &schema);
+	void Compute(const IcebergMultiFileList &multi_file_list);
+
+public:
+	//! The amount of records in the data files (not accounting for deletes)
+	idx_t record_count = 0;
+	//! Whether the snapshot has any delete files
+	bool has_deletes = false;
+	//! The (top-level) columns of the schema, in order
+	vector<LogicalType> types;
+	vector<int32_t> field_ids;
+	vector<string> names;
+	vector<IcebergColumnStatistics> columns;
+};
+
+} // namespace duckdb
@@ -43,6 +43,8 @@ struct IcebergManifest {
 public:
 	//! Path to the manifest AVRO file
 	string manifest_path;
+	//! Length of the manifest file in bytes (0 if unknown)
+	idx_t manifest_length = 0;
 	//! sequence_number when manifest was added to table (0 for Iceberg v1)
 	sequence_number_t sequence_number;
 	//! either data or deletes
@@ -51,6 +53,12 @@ public:
 	idx_t added_rows_count = 0;
 	//! existing rows in the manifest
 	idx_t existing_rows_count = 0;
+	//! added (live) files in the manifest
+	idx_t added_files_count = 0;
+	//! existing (live) files in the manifest
+	idx_t existing_files_count = 0;
+	//! Whether the file counts are known (they are optional in v1)
+	bool has_file_counts = false;
 	//! The id of the partition spec referenced by this manifest (and the data files that are part of it)
 	int32_t partition_spec_id;
 	//! The field summaries of the partition (if present)
@@ -107,6 +115,12 @@ public:
 	//! Inherited from the 'manifest_file'
 	int32_t partition_spec_id;
 	int64_t file_size_in_bytes;
+	//! ----- v3 Deletion Vectors -----
+	//! The data file that all the deletes of this delete file apply to, empty if not set
+	string referenced_data_file;
+	//! The position of the deletion vector blob in the 'puffin' file
+	int64_t content_offset = 0;
+	int64_t content_size_in_bytes = 0;
 
 public:
 	static vector<LogicalType> Types() {
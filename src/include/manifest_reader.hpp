@@ -3,6 +3,12 @@
 #include "iceberg_options.hpp"
 #include "iceberg_types.hpp"
 #include "iceberg_manifest.hpp"
+#include "iceberg_manifest_entry_store.hpp"
+#include "iceberg_pruning_program.hpp"
+#include "metadata/iceberg_partition_spec.hpp"
+#include "metadata/iceberg_table_schema.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/unordered_set.hpp"
 
 namespace duckdb {
 
@@ -11,9 +17,6 @@ namespace duckdb {
 class BaseManifestReader {
 public:
 	BaseManifestReader(idx_t iceberg_version) : iceberg_version(iceberg_version) {
-		if (iceberg_version > 2) {
-			throw InvalidConfigurationException("Iceberg version > 2 is not supported yet");
-		}
 	}
 	virtual ~BaseManifestReader() {
 	}
@@ -23,6 +26,10 @@ public:
 	bool Finished() const;
 	virtual void CreateNameMapping(idx_t i, const LogicalType &type, const string &name) = 0;
 	virtual bool ValidateNameMapping() = 0;
+	//! Whether the column (or field of the 'data_file') is used by the reader, unused columns are not scanned
+	virtual bool ProjectColumn(const string &name) const {
+		return true;
+	}
 
 protected:
 	idx_t ScanInternal(idx_t remaining);
@@ -52,6 +59,32 @@ private:
 	idx_t ReadChunk(idx_t offset, idx_t count, vector<IcebergManifest> &result);
 };
 
+//! A pushed down filter, checked against the bounds of the column in the 'data_file'
+struct ManifestEntryFilter {
+public:
+	ManifestEntryFilter(const IcebergColumnDefinition &column, TableFilter &filter,
+	                    optional_ptr<const IcebergColumnPruner> pruner)
+	    : column(column), filter(filter), pruner(pruner) {
+	}
+
+public:
+	const IcebergColumnDefinition &column;
+	TableFilter &filter;
+	//! The compiled filter, checked against the raw bounds before (or instead of) the filter itself
+	optional_ptr<const IcebergColumnPruner> pruner;
+};
+
+//! A pushed down filter, checked against the partition value of the 'data_file' for a field of the partition spec
+struct ManifestPartitionFilter {
+public:
+	ManifestPartitionFilter(const IcebergPartitionSpecField &field, TableFilter &filter) : field(field), filter(filter) {
+	}
+
+public:
+	const IcebergPartitionSpecField &field;
+	TableFilter &filter;
+};
+
 //! Produces IcebergManifestEntries read, from the 'manifest_file'
 class ManifestFileReader : public BaseManifestReader {
 public:
@@ -61,15 +94,40 @@ public:
 
 public:
 	idx_t Read(idx_t count, vector<IcebergManifestEntry> &result);
+	//! Read the (data) entries into a columnar store
+	idx_t Read(idx_t count, IcebergManifestEntryStore &result);
+	//! Read the entries of a cached data manifest (read with all its metrics) that match the filters
+	//! The reader is not initialized with a scan for this, only its filters and 'metrics_field_ids' are used
+	idx_t ReadCached(ClientContext &context, const IcebergManifestEntryStore &entries,
+	                 IcebergManifestEntryStore &result) const;
 	void CreateNameMapping(idx_t i, const LogicalType &type, const string &name) override;
 	bool ValidateNameMapping() override;
+	bool ProjectColumn(const string &name) const override;
 
 public:
 	void SetSequenceNumber(sequence_number_t sequence_number);
 	void SetPartitionSpecID(int32_t partition_spec_id);
+	void SetReadMetrics(bool read_metrics);
+	//! Set the filters the data files have to match, the filters (schema and program) have to outlive the reader
+	void SetFilters(const TableFilterSet &filters, const IcebergTableSchema &schema,
+	                optional_ptr<const IcebergPruningProgram> program = nullptr);
+	//! Set the filters the partition values of the data files have to match (for the fields of 'partition_spec')
+	void SetPartitionFilters(const TableFilterSet &filters, const IcebergTableSchema &schema,
+	                         const IcebergPartitionSpec &partition_spec);
+	//! Set the paths of the data files to skip, the set has to outlive the reader
+	void SetSkippedFiles(const unordered_set<string> &skipped_files);
 
 private:
+	template <class RESULT>
+	idx_t ReadInternal(idx_t count, RESULT &result);
 	idx_t ReadChunk(idx_t offset, idx_t count, vector<IcebergManifestEntry> &result);
+	idx_t ReadChunk(idx_t offset, idx_t count, IcebergManifestEntryStore &result);
+	//! Select the entries of the chunk that have to be produced, returns the amount selected
+	idx_t SelectEntries(idx_t offset, idx_t count, SelectionVector &sel);
+	//! Whether the partition value of the entry matches the partition filters
+	bool MatchesPartitionFilters(const vector<optional_ptr<Vector>> &partition_fields, idx_t index) const;
+	//! Whether the entry of a cached data manifest matches the filters and partition filters
+	bool MatchesCachedEntry(const IcebergManifestEntryStore &entries, idx_t index) const;
 
 public:
 	//! The sequence number to inherit when the condition to do so is met
@@ -78,6 +136,16 @@ public:
 	int32_t partition_spec_id;
 	//! Whether the deleted entries should be skipped outright
 	bool skip_deleted = false;
+	//! Whether the column metrics (bounds, value/null/nan counts) should be read, only needed for filtering
+	bool read_metrics = true;
+	//! The filters the produced data files have to match
+	vector<ManifestEntryFilter> filters;
+	//! The filters the partition values of the produced data files have to match
+	vector<ManifestPartitionFilter> partition_filters;
+	//! The field ids to keep the metrics of, all are kept when empty
+	unordered_set<int32_t> metrics_field_ids;
+	//! The data files that are not produced (by path)
+	optional_ptr<const unordered_set<string>> skipped_files;
 };
 
 } // namespace duckdb
@@ -1,5 +1,6 @@
 #pragma once
 #include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/string_type.hpp"
 
 namespace duckdb {
 
@@ -8,6 +9,14 @@ public:
 	IcebergPredicateStats() {
 	}
 
+public:
+	//! Deserialize a (binary single-value serialized) bound of the column
+	static Value DeserializeBound(const string_t &bound, const string &name, const LogicalType &type,
+	                              const char *bound_name);
+	//! Deserialize the lower and upper bound, a NULL bound results in a NULL value of 'type'
+	void DeserializeBounds(const Value &lower_bound, const Value &upper_bound, const string &name,
+	                       const LogicalType &type);
+
 public:
 	Value lower_bound;
 	Value upper_bound;
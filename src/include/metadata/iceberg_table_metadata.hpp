@@ -9,6 +9,9 @@
 #include "iceberg_options.hpp"
 #include "rest_catalog/objects/table_metadata.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/storage/object_cache.hpp"
 
 namespace duckdb {
 
@@ -20,6 +23,9 @@ public:
 	static rest_api_objects::TableMetadata Parse(const string &path, FileSystem &fs,
 	                                             const string &metadata_compression_codec);
 	static IcebergTableMetadata FromTableMetadata(rest_api_objects::TableMetadata &table_metadata);
+	//! Parse the metadata file at the (resolved) 'path', or get the result of an earlier parse from the cache
+	static shared_ptr<IcebergTableMetadata> Load(ClientContext &context, const string &path, FileSystem &fs,
+	                                             const string &metadata_compression_codec);
 	static string GetMetaDataPath(ClientContext &context, const string &path, FileSystem &fs,
 	                              const IcebergOptions &options);
 	optional_ptr<IcebergSnapshot> GetLatestSnapshot();
@@ -50,4 +56,42 @@ public:
 	vector<IcebergFieldMapping> mappings;
 };
 
+//! Database-wide cache of parsed metadata files, keyed by the path of the metadata file
+//! A metadata file is never rewritten (a commit writes a new one), so an entry never has to be invalidated
+class IcebergTableMetadataCache : public ObjectCacheEntry {
+public:
+	static constexpr const char *CACHE_KEY = "iceberg_table_metadata_cache";
+
+public:
+	//! Get the cache of the database instance
+	static IcebergTableMetadataCache &Get(ClientContext &context);
+	//! Get the configured maximum amount of cached metadata files, 0 if the cache is disabled
+	static idx_t GetMaxEntries(ClientContext &context);
+
+public:
+	shared_ptr<IcebergTableMetadata> Get(const string &key);
+	//! Add the entry, evicting the least recently used entries to stay within 'max_entries'
+	void Put(const string &key, shared_ptr<IcebergTableMetadata> metadata, idx_t max_entries);
+
+public:
+	static string ObjectType() {
+		return "iceberg_table_metadata_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct CacheEntry {
+		shared_ptr<IcebergTableMetadata> metadata;
+		list<string>::iterator lru_position;
+	};
+
+private:
+	mutex lock;
+	unordered_map<string, CacheEntry> entries;
+	//! The least recently used entry is at the back
+	list<string> lru;
+};
+
 } // namespace duckdb
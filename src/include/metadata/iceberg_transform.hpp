@@ -39,6 +39,17 @@ public:
 	}
 
 	LogicalType GetSerializedType(const LogicalType &input) const;
+	//! The 32-bit Murmur3 hash of a value, as specified for the 'bucket' transform
+	//! Returns false if the value can't be hashed (NULL or an unsupported type)
+	static bool TryHashValue(const Value &value, int32_t &result);
+	//! Apply truncate[width] to a value: integers and decimals are rounded down to a multiple of the width,
+	//! strings are cut to 'width' code points and binary values to 'width' bytes
+	static Value TruncateValue(const Value &value, idx_t width);
+	//! Whether any string in the [lower_bound, upper_bound] range could start with the prefix
+	static bool BoundsContainPrefix(const Value &prefix, const IcebergPredicateStats &stats);
+	//! Apply the year, month, day or hour transform to a date or timestamp, as an offset from 1970-01-01 00:00:00
+	//! 'partition_start' is set when the value is the first value of its partition
+	static Value ApplyTemporalTransform(const Value &value, IcebergTransformType type, bool &partition_start);
 
 private:
 	//! Preserve the input for debugging
@@ -49,9 +60,15 @@ private:
 };
 
 struct IdentityTransform {
+	//! Whether 'a <= b' implies 'T(a) <= T(b)'
+	static constexpr bool PRESERVES_ORDER = true;
+
 	static Value ApplyTransform(const Value &constant, const IcebergTransform &transform) {
 		return constant;
 	}
+	static bool StartsPartition(const Value &constant, const IcebergTransform &transform) {
+		return false;
+	}
 	static bool CompareEqual(const Value &constant, const IcebergPredicateStats &stats) {
 		return constant >= stats.lower_bound && constant <= stats.upper_bound;
 	}
@@ -67,32 +84,25 @@ struct IdentityTransform {
 	static bool CompareGreaterThanOrEqual(const Value &constant, const IcebergPredicateStats &stats) {
 		return stats.upper_bound >= constant;
 	}
+	static bool CompareStartsWith(const Value &prefix, const IcebergPredicateStats &stats) {
+		return IcebergTransform::BoundsContainPrefix(prefix, stats);
+	}
 };
 
-struct YearTransform {
+template <IcebergTransformType TYPE>
+struct TemporalTransform {
+	//! Whether 'a <= b' implies 'T(a) <= T(b)'
+	static constexpr bool PRESERVES_ORDER = true;
+
 	static Value ApplyTransform(const Value &constant, const IcebergTransform &transform) {
-		switch (constant.type().id()) {
-		case LogicalTypeId::TIMESTAMP: {
-			auto val = constant.GetValue<timestamp_t>();
-			auto components = Timestamp::GetComponents(val);
-			return Value::INTEGER(components.year - 1970);
-		}
-		case LogicalTypeId::TIMESTAMP_TZ: {
-			auto val = constant.GetValue<timestamp_tz_t>();
-			auto components = Timestamp::GetComponents(val);
-			return Value::INTEGER(components.year - 1970);
-		}
-		case LogicalTypeId::DATE: {
-			int32_t year;
-			int32_t month;
-			int32_t day;
-			Date::Convert(constant.GetValue<date_t>(), year, month, day);
-			return Value::INTEGER(year - 1970);
-		}
-		default:
-			throw NotImplementedException("'year' transform for type %s", constant.type().ToString());
-		}
-		return constant;
+		bool partition_start;
+		return IcebergTransform::ApplyTemporalTransform(constant, TYPE, partition_start);
+	}
+	//! Whether the constant is the first value of its partition, so 'x < constant' excludes the whole partition
+	static bool StartsPartition(const Value &constant, const IcebergTransform &transform) {
+		bool partition_start;
+		auto result = IcebergTransform::ApplyTemporalTransform(constant, TYPE, partition_start);
+		return !result.IsNull() && partition_start;
 	}
 	static bool CompareEqual(const Value &constant, const IcebergPredicateStats &stats) {
 		return constant >= stats.lower_bound && constant <= stats.upper_bound;
@@ -109,27 +119,83 @@ struct YearTransform {
 	static bool CompareGreaterThanOrEqual(const Value &constant, const IcebergPredicateStats &stats) {
 		return stats.upper_bound >= constant;
 	}
+	static bool CompareStartsWith(const Value &prefix, const IcebergPredicateStats &stats) {
+		return true;
+	}
+};
+
+using YearTransform = TemporalTransform<IcebergTransformType::YEAR>;
+using MonthTransform = TemporalTransform<IcebergTransformType::MONTH>;
+using DayTransform = TemporalTransform<IcebergTransformType::DAY>;
+using HourTransform = TemporalTransform<IcebergTransformType::HOUR>;
+
+struct BucketTransform {
+	//! Whether 'a <= b' implies 'T(a) <= T(b)'
+	static constexpr bool PRESERVES_ORDER = false;
+
+	static Value ApplyTransform(const Value &constant, const IcebergTransform &transform) {
+		int32_t hash;
+		if (!IcebergTransform::TryHashValue(constant, hash)) {
+			//! Can't be hashed, a NULL constant is never used to filter
+			return Value(LogicalType::INTEGER);
+		}
+		auto modulo = NumericCast<int32_t>(transform.GetBucketModulo());
+		return Value::INTEGER((hash & NumericLimits<int32_t>::Maximum()) % modulo);
+	}
+	static bool StartsPartition(const Value &constant, const IcebergTransform &transform) {
+		return false;
+	}
+	static bool CompareEqual(const Value &constant, const IcebergPredicateStats &stats) {
+		return constant >= stats.lower_bound && constant <= stats.upper_bound;
+	}
+	//! The bucket ids don't preserve the order of the values, a range can't be pruned
+	static bool CompareLessThan(const Value &constant, const IcebergPredicateStats &stats) {
+		return true;
+	}
+	static bool CompareLessThanOrEqual(const Value &constant, const IcebergPredicateStats &stats) {
+		return true;
+	}
+	static bool CompareGreaterThan(const Value &constant, const IcebergPredicateStats &stats) {
+		return true;
+	}
+	static bool CompareGreaterThanOrEqual(const Value &constant, const IcebergPredicateStats &stats) {
+		return true;
+	}
+	static bool CompareStartsWith(const Value &prefix, const IcebergPredicateStats &stats) {
+		return true;
+	}
 };
 
-// struct DayTransform {
-//	static Value ApplyTransform(const Value &constant, const IcebergTransform &transform) {
-//		throw NotImplementedException("'day' transform ApplyTransform");
-//	}
-//	static bool CompareEqual(const Value &constant, const IcebergPredicateStats &stats) {
-//		return constant >= stats.lower_bound && constant <= stats.upper_bound;
-//	}
-//	static bool CompareLessThan(const Value &constant, const IcebergPredicateStats &stats) {
-//		return stats.lower_bound <= constant;
-//	}
-//	static bool CompareLessThanOrEqual(const Value &constant, const IcebergPredicateStats &stats) {
-//		return stats.lower_bound <= constant;
-//	}
-//	static bool CompareGreaterThan(const Value &constant, const IcebergPredicateStats &stats) {
-//		return stats.upper_bound >= constant;
-//	}
-//	static bool CompareGreaterThanOrEqual(const Value &constant, const IcebergPredicateStats &stats) {
-//		return stats.upper_bound >= constant;
-//	}
-//};
+struct TruncateTransform {
+	//! Whether 'a <= b' implies 'T(a) <= T(b)'
+	static constexpr bool PRESERVES_ORDER = true;
+
+	static Value ApplyTransform(const Value &constant, const IcebergTransform &transform) {
+		return IcebergTransform::TruncateValue(constant, transform.GetTruncateWidth());
+	}
+	static bool StartsPartition(const Value &constant, const IcebergTransform &transform) {
+		return false;
+	}
+	static bool CompareEqual(const Value &constant, const IcebergPredicateStats &stats) {
+		return constant >= stats.lower_bound && constant <= stats.upper_bound;
+	}
+	//! truncate[W] preserves the order, but values on either side of the constant share its partition
+	static bool CompareLessThan(const Value &constant, const IcebergPredicateStats &stats) {
+		return stats.lower_bound <= constant;
+	}
+	static bool CompareLessThanOrEqual(const Value &constant, const IcebergPredicateStats &stats) {
+		return stats.lower_bound <= constant;
+	}
+	static bool CompareGreaterThan(const Value &constant, const IcebergPredicateStats &stats) {
+		return stats.upper_bound >= constant;
+	}
+	static bool CompareGreaterThanOrEqual(const Value &constant, const IcebergPredicateStats &stats) {
+		return stats.upper_bound >= constant;
+	}
+	//! The truncated prefix either still is a prefix of the partition value, or the partition value itself
+	static bool CompareStartsWith(const Value &prefix, const IcebergPredicateStats &stats) {
+		return IcebergTransform::BoundsContainPrefix(prefix, stats);
+	}
+};
 
 } // namespace duckdb
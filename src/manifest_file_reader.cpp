@@ -1,4 +1,6 @@
 #include "manifest_reader.hpp"
+#include "iceberg_logging.hpp"
+#include "iceberg_predicate.hpp"
 
 namespace duckdb {
 
@@ -14,7 +16,12 @@ void ManifestFileReader::SetPartitionSpecID(int32_t partition_spec_id_p) {
 	partition_spec_id = partition_spec_id_p;
 }
 
-idx_t ManifestFileReader::Read(idx_t count, vector<IcebergManifestEntry> &result) {
+void ManifestFileReader::SetReadMetrics(bool read_metrics_p) {
+	read_metrics = read_metrics_p;
+}
+
+template <class RESULT>
+idx_t ManifestFileReader::ReadInternal(idx_t count, RESULT &result) {
 	if (!scan || finished) {
 		return 0;
 	}
@@ -33,6 +40,14 @@ idx_t ManifestFileReader::Read(idx_t count, vector<IcebergManifestEntry> &result
 	return total_added;
 }
 
+idx_t ManifestFileReader::Read(idx_t count, vector<IcebergManifestEntry> &result) {
+	return ReadInternal(count, result);
+}
+
+idx_t ManifestFileReader::Read(idx_t count, IcebergManifestEntryStore &result) {
+	return ReadInternal(count, result);
+}
+
 void ManifestFileReader::CreateNameMapping(idx_t column_id, const LogicalType &type, const string &name) {
 	auto lname = StringUtil::Lower(name);
 	if (lname != "data_file") {
@@ -73,12 +88,70 @@ bool ManifestFileReader::ValidateNameMapping() {
 	return true;
 }
 
-static unordered_map<int32_t, Value> GetBounds(Vector &bounds, idx_t index) {
-	auto &bounds_child = ListVector::GetEntry(bounds);
-	auto keys = FlatVector::GetData<int32_t>(*StructVector::GetEntries(bounds_child)[0]);
-	auto &values = *StructVector::GetEntries(bounds_child)[1];
-	auto bounds_list = FlatVector::GetData<list_entry_t>(bounds);
+void ManifestFileReader::SetFilters(const TableFilterSet &table_filters, const IcebergTableSchema &schema,
+                                    optional_ptr<const IcebergPruningProgram> program) {
+	filters.clear();
+	metrics_field_ids.clear();
+	auto &columns = schema.columns;
+	for (idx_t column_id = 0; column_id < columns.size(); column_id++) {
+		// FIXME: is there a potential mismatch between column_id / field_id lurking here?
+		auto it = table_filters.filters.find(column_id);
+		if (it == table_filters.filters.end()) {
+			continue;
+		}
+		optional_ptr<const IcebergColumnPruner> pruner;
+		if (program) {
+			pruner = program->GetColumnPruner(column_id);
+		}
+		filters.emplace_back(*columns[column_id], *it->second, pruner);
+		//! Only the metrics of the filtered columns are used, the rest are not kept
+		metrics_field_ids.insert(columns[column_id]->id);
+	}
+}
+
+void ManifestFileReader::SetPartitionFilters(const TableFilterSet &table_filters, const IcebergTableSchema &schema,
+                                             const IcebergPartitionSpec &partition_spec) {
+	partition_filters.clear();
+	auto &columns = schema.columns;
+	for (auto &field : partition_spec.fields) {
+		for (idx_t column_id = 0; column_id < columns.size(); column_id++) {
+			if (static_cast<uint64_t>(columns[column_id]->id) != field.source_id) {
+				continue;
+			}
+			auto it = table_filters.filters.find(column_id);
+			if (it != table_filters.filters.end()) {
+				partition_filters.emplace_back(field, *it->second);
+			}
+			break;
+		}
+	}
+}
+
+void ManifestFileReader::SetSkippedFiles(const unordered_set<string> &skipped_files_p) {
+	skipped_files = skipped_files_p;
+}
+
+bool ManifestFileReader::ProjectColumn(const string &name) const {
+	if (name == "status" || name == "sequence_number" || name == "content" || name == "file_path" ||
+	    name == "file_format" || name == "record_count" || name == "file_size_in_bytes" || name == "partition" ||
+	    name == "equality_ids" || name == "referenced_data_file" || name == "content_offset" ||
+	    name == "content_size_in_bytes") {
+		return true;
+	}
+	if (name == "lower_bounds" || name == "upper_bounds" || name == "null_value_counts" ||
+	    name == "nan_value_counts" || name == "value_counts") {
+		//! The metrics make up most of the manifest for wide tables, only read them when they're used
+		return read_metrics;
+	}
+	return false;
+}
 
+//! Whether the metrics of the field are kept, all are kept if there is no 'field_ids' restriction
+static bool KeepFieldMetrics(const unordered_set<int32_t> &field_ids, int32_t field_id) {
+	return field_ids.empty() || field_ids.count(field_id);
+}
+
+static unordered_map<int32_t, Value> GetBounds(Vector &bounds, idx_t index, const unordered_set<int32_t> &field_ids) {
 	unordered_map<int32_t, Value> parsed_bounds;
 
 	auto &validity = FlatVector::Validity(bounds);
@@ -86,20 +159,31 @@ static unordered_map<int32_t, Value> GetBounds(Vector &bounds, idx_t index) {
 		return parsed_bounds;
 	}
 
+	auto &bounds_child = ListVector::GetEntry(bounds);
+	auto keys = FlatVector::GetData<int32_t>(*StructVector::GetEntries(bounds_child)[0]);
+	auto &values = *StructVector::GetEntries(bounds_child)[1];
+	auto values_data = FlatVector::GetData<string_t>(values);
+	auto &values_validity = FlatVector::Validity(values);
+	auto bounds_list = FlatVector::GetData<list_entry_t>(bounds);
+
 	auto list_entry = bounds_list[index];
 	for (idx_t j = 0; j < list_entry.length; j++) {
 		auto list_idx = list_entry.offset + j;
-		parsed_bounds[keys[list_idx]] = values.GetValue(list_idx);
+		if (!KeepFieldMetrics(field_ids, keys[list_idx])) {
+			continue;
+		}
+		if (!values_validity.RowIsValid(list_idx)) {
+			parsed_bounds[keys[list_idx]] = Value(LogicalType::BLOB);
+			continue;
+		}
+		auto &blob = values_data[list_idx];
+		parsed_bounds[keys[list_idx]] = Value::BLOB(const_data_ptr_cast(blob.GetData()), blob.GetSize());
 	}
 	return parsed_bounds;
 }
 
-static unordered_map<int32_t, int64_t> GetCounts(Vector &counts, idx_t index) {
-	auto &counts_child = ListVector::GetEntry(counts);
-	auto keys = FlatVector::GetData<int32_t>(*StructVector::GetEntries(counts_child)[0]);
-	auto values = FlatVector::GetData<int64_t>(*StructVector::GetEntries(counts_child)[1]);
-	auto counts_list = FlatVector::GetData<list_entry_t>(counts);
-
+static unordered_map<int32_t, int64_t> GetCounts(Vector &counts, idx_t index,
+                                                 const unordered_set<int32_t> &field_ids) {
 	unordered_map<int32_t, int64_t> parsed_counts;
 
 	auto &validity = FlatVector::Validity(counts);
@@ -107,9 +191,17 @@ static unordered_map<int32_t, int64_t> GetCounts(Vector &counts, idx_t index) {
 		return parsed_counts;
 	}
 
+	auto &counts_child = ListVector::GetEntry(counts);
+	auto keys = FlatVector::GetData<int32_t>(*StructVector::GetEntries(counts_child)[0]);
+	auto values = FlatVector::GetData<int64_t>(*StructVector::GetEntries(counts_child)[1]);
+	auto counts_list = FlatVector::GetData<list_entry_t>(counts);
+
 	auto list_entry = counts_list[index];
 	for (idx_t j = 0; j < list_entry.length; j++) {
 		auto list_idx = list_entry.offset + j;
+		if (!KeepFieldMetrics(field_ids, keys[list_idx])) {
+			continue;
+		}
 		parsed_counts[keys[list_idx]] = values[list_idx];
 	}
 	return parsed_counts;
@@ -134,12 +226,275 @@ static vector<int32_t> GetEqualityIds(Vector &equality_ids, idx_t index) {
 	return result;
 }
 
+static optional_ptr<Vector> GetDataFileField(DataChunk &chunk, const case_insensitive_map_t<ColumnIndex> &name_to_vec,
+                                             const string &name) {
+	auto it = name_to_vec.find(name);
+	if (it == name_to_vec.end()) {
+		return nullptr;
+	}
+	auto &column_index = it->second;
+	auto &child_entries = StructVector::GetEntries(chunk.data[column_index.GetPrimaryIndex()]);
+	return *child_entries[column_index.GetChildIndex(0).GetPrimaryIndex()];
+}
+
+//! Whether the (map) list of the entry has any fields
+static bool HasFieldEntries(Vector &map, idx_t index) {
+	if (!FlatVector::Validity(map).RowIsValid(index)) {
+		return false;
+	}
+	return FlatVector::GetData<list_entry_t>(map)[index].length != 0;
+}
+
+//! Find the position of 'field_id' in the child of the (map) list, for the entry at 'index'
+static bool FindFieldEntry(Vector &map, idx_t index, int32_t field_id, idx_t &result) {
+	if (!FlatVector::Validity(map).RowIsValid(index)) {
+		return false;
+	}
+	auto &map_child = ListVector::GetEntry(map);
+	auto keys = FlatVector::GetData<int32_t>(*StructVector::GetEntries(map_child)[0]);
+	auto list_entry = FlatVector::GetData<list_entry_t>(map)[index];
+	for (idx_t j = 0; j < list_entry.length; j++) {
+		auto list_idx = list_entry.offset + j;
+		if (keys[list_idx] == field_id) {
+			result = list_idx;
+			return true;
+		}
+	}
+	return false;
+}
+
+//! Get the serialized bound of the field, without deserializing it, nullptr if it's missing
+static const string_t *GetRawBound(Vector &bounds, idx_t index, int32_t field_id) {
+	idx_t list_idx;
+	if (!FindFieldEntry(bounds, index, field_id, list_idx)) {
+		return nullptr;
+	}
+	auto &values = *StructVector::GetEntries(ListVector::GetEntry(bounds))[1];
+	if (!FlatVector::Validity(values).RowIsValid(list_idx)) {
+		return nullptr;
+	}
+	return FlatVector::GetData<string_t>(values) + list_idx;
+}
+
+//! Get the count of the field, nullptr if it's missing
+static const int64_t *GetRawCount(Vector &counts, idx_t index, int32_t field_id) {
+	idx_t list_idx;
+	if (!FindFieldEntry(counts, index, field_id, list_idx)) {
+		return nullptr;
+	}
+	return FlatVector::GetData<int64_t>(*StructVector::GetEntries(ListVector::GetEntry(counts))[1]) + list_idx;
+}
+
+//! Whether the partition value of a data file matches the partition filter
+static bool MatchesPartitionFilter(const ManifestPartitionFilter &partition_filter, Value value) {
+	auto &transform = partition_filter.field.transform;
+	if (!value.IsNull() && value.type().id() == LogicalTypeId::DATE && transform == IcebergTransformType::DAY) {
+		//! 'day' partition values are stored as a date, the transform produces the days since epoch
+		value = Value::INTEGER(value.GetValue<date_t>().days);
+	}
+	//! A partition value is a single value, it's both the lower and the upper bound
+	IcebergPredicateStats stats;
+	stats.lower_bound = value;
+	stats.upper_bound = value;
+	stats.has_null = value.IsNull();
+	return IcebergPredicate::MatchBounds(partition_filter.filter, stats, transform);
+}
+
+//! Whether a data file can contain rows that match the filter, given the metrics of the filtered column
+//! The metrics that are missing are nullptr
+static bool MatchesEntryFilter(const ManifestEntryFilter &entry_filter, const string_t *lower_bound,
+                               const string_t *upper_bound, const int64_t *null_value_count,
+                               const int64_t *nan_value_count) {
+	auto &column = entry_filter.column;
+	if (entry_filter.pruner) {
+		auto &pruner = *entry_filter.pruner;
+		if (!pruner.MatchBounds(lower_bound, upper_bound)) {
+			return false;
+		}
+		if (!pruner.has_residual) {
+			return true;
+		}
+	}
+
+	IcebergPredicateStats stats;
+	stats.lower_bound =
+	    lower_bound ? IcebergPredicateStats::DeserializeBound(*lower_bound, column.name, column.type, "lower bound")
+	                : Value(column.type);
+	stats.upper_bound =
+	    upper_bound ? IcebergPredicateStats::DeserializeBound(*upper_bound, column.name, column.type, "upper bound")
+	                : Value(column.type);
+	if (null_value_count) {
+		stats.has_null = *null_value_count != 0;
+	}
+	if (nan_value_count) {
+		stats.has_nan = *nan_value_count != 0;
+	}
+	return IcebergPredicate::MatchBounds(entry_filter.filter, stats, IcebergTransform::Identity());
+}
+
+bool ManifestFileReader::MatchesPartitionFilters(const vector<optional_ptr<Vector>> &partition_fields,
+                                                 idx_t index) const {
+	for (idx_t i = 0; i < partition_fields.size(); i++) {
+		if (!partition_fields[i]) {
+			continue;
+		}
+		if (!MatchesPartitionFilter(partition_filters[i], partition_fields[i]->GetValue(index))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+idx_t ManifestFileReader::SelectEntries(idx_t offset, idx_t count, SelectionVector &sel) {
+	auto status = FlatVector::GetData<int32_t>(chunk.data[name_to_vec.at("status").GetPrimaryIndex()]);
+
+	auto lower_bounds = GetDataFileField(chunk, name_to_vec, "lower_bounds");
+	auto upper_bounds = GetDataFileField(chunk, name_to_vec, "upper_bounds");
+	auto null_value_counts = GetDataFileField(chunk, name_to_vec, "null_value_counts");
+	auto nan_value_counts = GetDataFileField(chunk, name_to_vec, "nan_value_counts");
+	const bool check_filters = !filters.empty() && lower_bounds && upper_bounds;
+	string_t *file_path = nullptr;
+	if (skipped_files) {
+		file_path = FlatVector::GetData<string_t>(*GetDataFileField(chunk, name_to_vec, "file_path"));
+	}
+	//! The partition fields (of the struct) that the partition filters apply to
+	vector<optional_ptr<Vector>> partition_fields;
+	auto partition = GetDataFileField(chunk, name_to_vec, "partition");
+	if (!partition_filters.empty() && partition) {
+		auto &child_types = StructType::GetChildTypes(partition->GetType());
+		auto &child_vectors = StructVector::GetEntries(*partition);
+		for (auto &partition_filter : partition_filters) {
+			optional_ptr<Vector> partition_field;
+			for (idx_t i = 0; i < child_types.size(); i++) {
+				if (StringUtil::CIEquals(child_types[i].first, partition_filter.field.name)) {
+					partition_field = *child_vectors[i];
+					break;
+				}
+			}
+			partition_fields.push_back(partition_field);
+		}
+	}
+
+	idx_t selected = 0;
+	for (idx_t i = 0; i < count; i++) {
+		idx_t index = i + offset;
+
+		auto entry_status = (IcebergManifestEntryStatusType)status[index];
+		if (this->skip_deleted && entry_status == IcebergManifestEntryStatusType::DELETED) {
+			//! Skip this entry, we don't care about deleted entries
+			continue;
+		}
+		if (file_path && skipped_files->count(file_path[index].GetString())) {
+			continue;
+		}
+		if (!partition_fields.empty() && !MatchesPartitionFilters(partition_fields, index)) {
+			auto file_paths = FlatVector::GetData<string_t>(*GetDataFileField(chunk, name_to_vec, "file_path"));
+			DUCKDB_LOG(scan->context, IcebergLogType, "Iceberg Filter Pushdown, skipped 'data_file': '%s'",
+			           file_paths[index].GetString());
+			continue;
+		}
+		if (!check_filters || !HasFieldEntries(*lower_bounds, index) || !HasFieldEntries(*upper_bounds, index)) {
+			//! There are no bounds statistics for the file, can't filter
+			sel.set_index(selected++, index);
+			continue;
+		}
+
+		bool matches = true;
+		for (auto &entry_filter : filters) {
+			auto field_id = entry_filter.column.id;
+			auto lower_bound = GetRawBound(*lower_bounds, index, field_id);
+			auto upper_bound = GetRawBound(*upper_bounds, index, field_id);
+			auto null_value_count = null_value_counts ? GetRawCount(*null_value_counts, index, field_id) : nullptr;
+			auto nan_value_count = nan_value_counts ? GetRawCount(*nan_value_counts, index, field_id) : nullptr;
+			if (!MatchesEntryFilter(entry_filter, lower_bound, upper_bound, null_value_count, nan_value_count)) {
+				//! If any predicate fails, exclude the file
+				matches = false;
+				break;
+			}
+		}
+		if (!matches) {
+			auto file_paths = FlatVector::GetData<string_t>(*GetDataFileField(chunk, name_to_vec, "file_path"));
+			DUCKDB_LOG(scan->context, IcebergLogType, "Iceberg Filter Pushdown, skipped 'data_file': '%s'",
+			           file_paths[index].GetString());
+			continue;
+		}
+		sel.set_index(selected++, index);
+	}
+	return selected;
+}
+
+bool ManifestFileReader::MatchesCachedEntry(const IcebergManifestEntryStore &entries, idx_t index) const {
+	auto &partition = entries.GetPartition(index);
+	if (!partition_filters.empty() && !partition.IsNull()) {
+		auto &child_types = StructType::GetChildTypes(partition.type());
+		auto &children = StructValue::GetChildren(partition);
+		for (auto &partition_filter : partition_filters) {
+			for (idx_t i = 0; i < child_types.size(); i++) {
+				if (!StringUtil::CIEquals(child_types[i].first, partition_filter.field.name)) {
+					continue;
+				}
+				if (!MatchesPartitionFilter(partition_filter, children[i])) {
+					return false;
+				}
+				break;
+			}
+		}
+	}
+	if (filters.empty() || !entries.HasBounds(index)) {
+		//! There are no bounds statistics for the file, can't filter
+		return true;
+	}
+	for (auto &entry_filter : filters) {
+		auto metrics = entries.GetMetrics(index, entry_filter.column.id);
+		const string_t *lower_bound = nullptr;
+		const string_t *upper_bound = nullptr;
+		const int64_t *null_value_count = nullptr;
+		const int64_t *nan_value_count = nullptr;
+		if (metrics) {
+			lower_bound = metrics->has_lower_bound ? &metrics->lower_bound : nullptr;
+			upper_bound = metrics->has_upper_bound ? &metrics->upper_bound : nullptr;
+			null_value_count = metrics->null_value_count >= 0 ? &metrics->null_value_count : nullptr;
+			nan_value_count = metrics->nan_value_count >= 0 ? &metrics->nan_value_count : nullptr;
+		}
+		if (!MatchesEntryFilter(entry_filter, lower_bound, upper_bound, null_value_count, nan_value_count)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+idx_t ManifestFileReader::ReadCached(ClientContext &context, const IcebergManifestEntryStore &entries,
+                                     IcebergManifestEntryStore &result) const {
+	idx_t selected = 0;
+	for (idx_t index = 0; index < entries.Count(); index++) {
+		auto &file_path = entries.GetFilePath(index);
+		if (skipped_files && skipped_files->count(file_path.GetString())) {
+			continue;
+		}
+		if (!MatchesCachedEntry(entries, index)) {
+			DUCKDB_LOG(context, IcebergLogType, "Iceberg Filter Pushdown, skipped 'data_file': '%s'",
+			           file_path.GetString());
+			continue;
+		}
+		result.Append(entries, index, read_metrics, metrics_field_ids);
+		selected++;
+	}
+	return selected;
+}
+
 idx_t ManifestFileReader::ReadChunk(idx_t offset, idx_t count, vector<IcebergManifestEntry> &result) {
 	D_ASSERT(offset < chunk.size());
 	D_ASSERT(offset + count <= chunk.size());
 
 	auto status = FlatVector::GetData<int32_t>(chunk.data[name_to_vec.at("status").GetPrimaryIndex()]);
 
+	//! Select the entries to produce before anything is materialized
+	SelectionVector sel(count);
+	auto selected = SelectEntries(offset, count, sel);
+	if (selected == 0) {
+		return 0;
+	}
+
 	auto file_path_idx = name_to_vec.at("file_path");
 	auto data_file_idx = file_path_idx.GetPrimaryIndex();
 	auto &child_entries = StructVector::GetEntries(chunk.data[data_file_idx]);
@@ -200,18 +555,17 @@ idx_t ManifestFileReader::ReadChunk(idx_t offset, idx_t count, vector<IcebergMan
 		nan_value_counts = *child_entries[nan_value_counts_it->second.GetChildIndex(0).GetPrimaryIndex()];
 	}
 	auto &partition_vec = child_entries[partition_idx.GetChildIndex(0).GetPrimaryIndex()];
+	//! Added in v3, for deletion vectors
+	auto referenced_data_file = GetDataFileField(chunk, name_to_vec, "referenced_data_file");
+	auto content_offset = GetDataFileField(chunk, name_to_vec, "content_offset");
+	auto content_size_in_bytes = GetDataFileField(chunk, name_to_vec, "content_size_in_bytes");
 
-	idx_t produced = 0;
-	for (idx_t i = 0; i < count; i++) {
-		idx_t index = i + offset;
+	for (idx_t i = 0; i < selected; i++) {
+		idx_t index = sel.get_index(i);
 
 		IcebergManifestEntry entry;
 
 		entry.status = (IcebergManifestEntryStatusType)status[index];
-		if (this->skip_deleted && entry.status == IcebergManifestEntryStatusType::DELETED) {
-			//! Skip this entry, we don't care about deleted entries
-			continue;
-		}
 
 		entry.file_path = file_path[index].GetString();
 		entry.file_format = file_format[index].GetString();
@@ -219,17 +573,17 @@ idx_t ManifestFileReader::ReadChunk(idx_t offset, idx_t count, vector<IcebergMan
 		entry.file_size_in_bytes = file_size_in_bytes[index];
 
 		if (lower_bounds && upper_bounds) {
-			entry.lower_bounds = GetBounds(*lower_bounds, index);
-			entry.upper_bounds = GetBounds(*upper_bounds, index);
+			entry.lower_bounds = GetBounds(*lower_bounds, index, metrics_field_ids);
+			entry.upper_bounds = GetBounds(*upper_bounds, index, metrics_field_ids);
 		}
 		if (value_counts) {
-			entry.value_counts = GetCounts(*value_counts, index);
+			entry.value_counts = GetCounts(*value_counts, index, metrics_field_ids);
 		}
 		if (null_value_counts) {
-			entry.null_value_counts = GetCounts(*null_value_counts, index);
+			entry.null_value_counts = GetCounts(*null_value_counts, index, metrics_field_ids);
 		}
 		if (nan_value_counts) {
-			entry.nan_value_counts = GetCounts(*nan_value_counts, index);
+			entry.nan_value_counts = GetCounts(*nan_value_counts, index, metrics_field_ids);
 		}
 
 		if (iceberg_version > 1) {
@@ -258,12 +612,180 @@ idx_t ManifestFileReader::ReadChunk(idx_t offset, idx_t count, vector<IcebergMan
 			entry.content = IcebergManifestEntryContentType::DATA;
 		}
 
+		if (referenced_data_file && FlatVector::Validity(*referenced_data_file).RowIsValid(index)) {
+			entry.referenced_data_file = FlatVector::GetData<string_t>(*referenced_data_file)[index].GetString();
+		}
+		if (content_offset && FlatVector::Validity(*content_offset).RowIsValid(index)) {
+			entry.content_offset = FlatVector::GetData<int64_t>(*content_offset)[index];
+		}
+		if (content_size_in_bytes && FlatVector::Validity(*content_size_in_bytes).RowIsValid(index)) {
+			entry.content_size_in_bytes = FlatVector::GetData<int64_t>(*content_size_in_bytes)[index];
+		}
+
 		entry.partition_spec_id = this->partition_spec_id;
 		entry.partition = partition_vec->GetValue(index);
-		produced++;
-		result.push_back(entry);
+		result.push_back(std::move(entry));
+	}
+	return selected;
+}
+
+//! Get the metrics of the field for the entry that is being appended
+static IcebergColumnMetrics &GetColumnMetrics(int32_t field_id, IcebergManifestEntryStore &result,
+                                              unordered_map<int32_t, idx_t> &entry_metrics) {
+	auto it = entry_metrics.find(field_id);
+	if (it != entry_metrics.end()) {
+		return result.GetAppendedMetrics(it->second);
+	}
+	entry_metrics.emplace(field_id, result.AppendMetrics(field_id));
+	return result.GetAppendedMetrics(entry_metrics.at(field_id));
+}
+
+static void AppendBounds(Vector &bounds, idx_t index, bool lower, const unordered_set<int32_t> &field_ids,
+                         IcebergManifestEntryStore &result, unordered_map<int32_t, idx_t> &entry_metrics) {
+	if (!FlatVector::Validity(bounds).RowIsValid(index)) {
+		return;
+	}
+	auto &bounds_child = ListVector::GetEntry(bounds);
+	auto keys = FlatVector::GetData<int32_t>(*StructVector::GetEntries(bounds_child)[0]);
+	auto &values = *StructVector::GetEntries(bounds_child)[1];
+	auto values_data = FlatVector::GetData<string_t>(values);
+	auto &values_validity = FlatVector::Validity(values);
+
+	auto list_entry = FlatVector::GetData<list_entry_t>(bounds)[index];
+	for (idx_t j = 0; j < list_entry.length; j++) {
+		auto list_idx = list_entry.offset + j;
+		if (!values_validity.RowIsValid(list_idx) || !KeepFieldMetrics(field_ids, keys[list_idx])) {
+			continue;
+		}
+		auto bound = result.AddBound(values_data[list_idx]);
+		auto &metrics = GetColumnMetrics(keys[list_idx], result, entry_metrics);
+		if (lower) {
+			metrics.has_lower_bound = true;
+			metrics.lower_bound = bound;
+		} else {
+			metrics.has_upper_bound = true;
+			metrics.upper_bound = bound;
+		}
+	}
+}
+
+enum class IcebergColumnCountType : uint8_t { VALUE_COUNT, NULL_VALUE_COUNT, NAN_VALUE_COUNT };
+
+static void AppendCounts(Vector &counts, idx_t index, IcebergColumnCountType count_type,
+                         const unordered_set<int32_t> &field_ids, IcebergManifestEntryStore &result,
+                         unordered_map<int32_t, idx_t> &entry_metrics) {
+	if (!FlatVector::Validity(counts).RowIsValid(index)) {
+		return;
+	}
+	auto &counts_child = ListVector::GetEntry(counts);
+	auto keys = FlatVector::GetData<int32_t>(*StructVector::GetEntries(counts_child)[0]);
+	auto values = FlatVector::GetData<int64_t>(*StructVector::GetEntries(counts_child)[1]);
+
+	auto list_entry = FlatVector::GetData<list_entry_t>(counts)[index];
+	for (idx_t j = 0; j < list_entry.length; j++) {
+		auto list_idx = list_entry.offset + j;
+		if (!KeepFieldMetrics(field_ids, keys[list_idx])) {
+			continue;
+		}
+		auto &metrics = GetColumnMetrics(keys[list_idx], result, entry_metrics);
+		switch (count_type) {
+		case IcebergColumnCountType::VALUE_COUNT:
+			metrics.value_count = values[list_idx];
+			break;
+		case IcebergColumnCountType::NULL_VALUE_COUNT:
+			metrics.null_value_count = values[list_idx];
+			break;
+		case IcebergColumnCountType::NAN_VALUE_COUNT:
+			metrics.nan_value_count = values[list_idx];
+			break;
+		}
+	}
+}
+
+idx_t ManifestFileReader::ReadChunk(idx_t offset, idx_t count, IcebergManifestEntryStore &result) {
+	D_ASSERT(offset < chunk.size());
+	D_ASSERT(offset + count <= chunk.size());
+
+	//! Select the entries to produce before anything is materialized
+	SelectionVector sel(count);
+	auto selected = SelectEntries(offset, count, sel);
+	if (selected == 0) {
+		return 0;
+	}
+
+	auto file_path = FlatVector::GetData<string_t>(*GetDataFileField(chunk, name_to_vec, "file_path"));
+	auto file_format = FlatVector::GetData<string_t>(*GetDataFileField(chunk, name_to_vec, "file_format"));
+	auto record_count = FlatVector::GetData<int64_t>(*GetDataFileField(chunk, name_to_vec, "record_count"));
+	auto file_size_in_bytes =
+	    FlatVector::GetData<int64_t>(*GetDataFileField(chunk, name_to_vec, "file_size_in_bytes"));
+	auto &partition_vec = *GetDataFileField(chunk, name_to_vec, "partition");
+
+	int32_t *content = nullptr;
+	optional_ptr<Vector> sequence_number;
+	if (iceberg_version > 1) {
+		content = FlatVector::GetData<int32_t>(*GetDataFileField(chunk, name_to_vec, "content"));
+		auto sequence_number_it = name_to_vec.find("sequence_number");
+		if (sequence_number_it != name_to_vec.end()) {
+			sequence_number = chunk.data[sequence_number_it->second.GetPrimaryIndex()];
+		}
+	}
+
+	auto lower_bounds = GetDataFileField(chunk, name_to_vec, "lower_bounds");
+	auto upper_bounds = GetDataFileField(chunk, name_to_vec, "upper_bounds");
+	auto value_counts = GetDataFileField(chunk, name_to_vec, "value_counts");
+	auto null_value_counts = GetDataFileField(chunk, name_to_vec, "null_value_counts");
+	auto nan_value_counts = GetDataFileField(chunk, name_to_vec, "nan_value_counts");
+
+	//! field-id -> metrics of the entry that is being appended
+	unordered_map<int32_t, idx_t> entry_metrics;
+	for (idx_t i = 0; i < selected; i++) {
+		idx_t index = sel.get_index(i);
+
+		if (content) {
+			auto content_type = (IcebergManifestEntryContentType)content[index];
+			if (content_type != IcebergManifestEntryContentType::DATA) {
+				throw InvalidInputException("Data manifest contains a '%s' entry",
+				                            IcebergManifestEntry::ContentTypeToString(content_type));
+			}
+		}
+
+		sequence_number_t entry_sequence_number = this->sequence_number;
+		if (iceberg_version > 1) {
+			if (sequence_number) {
+				auto sequence_numbers = FlatVector::GetData<int64_t>(*sequence_number);
+				if (FlatVector::Validity(*sequence_number).RowIsValid(index)) {
+					entry_sequence_number = sequence_numbers[index];
+				}
+			} else {
+				//! Default to sequence number 0
+				//! (The 'manifest_file' should also have defaulted to 0)
+				D_ASSERT(this->sequence_number == 0);
+				entry_sequence_number = 0;
+			}
+		}
+
+		result.Append(file_path[index], file_format[index], record_count[index], file_size_in_bytes[index],
+		              entry_sequence_number, this->partition_spec_id, partition_vec.GetValue(index));
+
+		entry_metrics.clear();
+		if (lower_bounds && upper_bounds) {
+			AppendBounds(*lower_bounds, index, true, metrics_field_ids, result, entry_metrics);
+			AppendBounds(*upper_bounds, index, false, metrics_field_ids, result, entry_metrics);
+		}
+		if (value_counts) {
+			AppendCounts(*value_counts, index, IcebergColumnCountType::VALUE_COUNT, metrics_field_ids, result,
+			             entry_metrics);
+		}
+		if (null_value_counts) {
+			AppendCounts(*null_value_counts, index, IcebergColumnCountType::NULL_VALUE_COUNT, metrics_field_ids,
+			             result, entry_metrics);
+		}
+		if (nan_value_counts) {
+			AppendCounts(*nan_value_counts, index, IcebergColumnCountType::NAN_VALUE_COUNT, metrics_field_ids,
+			             result, entry_metrics);
+		}
 	}
-	return produced;
+	return selected;
 }
 
 } // namespace duckdb
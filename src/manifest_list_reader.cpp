@@ -32,6 +32,30 @@ idx_t ManifestListReader::ReadChunk(idx_t offset, idx_t count, vector<IcebergMan
 	auto partition_spec_id =
 	    FlatVector::GetData<int32_t>(chunk.data[name_to_vec.at("partition_spec_id").GetPrimaryIndex()]);
 
+	int64_t *manifest_length = nullptr;
+	auto manifest_length_it = name_to_vec.find("manifest_length");
+	if (manifest_length_it != name_to_vec.end()) {
+		manifest_length = FlatVector::GetData<int64_t>(chunk.data[manifest_length_it->second.GetPrimaryIndex()]);
+	}
+
+	//! 'added_files_count' + 'existing_files_count', optional in v1 (where older writers use the 'data_files' names)
+	optional_ptr<Vector> added_files_count;
+	optional_ptr<Vector> existing_files_count;
+	for (auto &name : {"added_files_count", "added_data_files_count"}) {
+		auto it = name_to_vec.find(name);
+		if (it != name_to_vec.end() && chunk.data[it->second.GetPrimaryIndex()].GetType() == LogicalType::INTEGER) {
+			added_files_count = chunk.data[it->second.GetPrimaryIndex()];
+			break;
+		}
+	}
+	for (auto &name : {"existing_files_count", "existing_data_files_count"}) {
+		auto it = name_to_vec.find(name);
+		if (it != name_to_vec.end() && chunk.data[it->second.GetPrimaryIndex()].GetType() == LogicalType::INTEGER) {
+			existing_files_count = chunk.data[it->second.GetPrimaryIndex()];
+			break;
+		}
+	}
+
 	int32_t *content = nullptr;
 	int64_t *sequence_number = nullptr;
 	int64_t *added_rows_count = nullptr;
@@ -91,6 +115,9 @@ idx_t ManifestListReader::ReadChunk(idx_t offset, idx_t count, vector<IcebergMan
 
 		IcebergManifest manifest;
 		manifest.manifest_path = manifest_path[index].GetString();
+		if (manifest_length) {
+			manifest.manifest_length = NumericCast<idx_t>(manifest_length[index]);
+		}
 		manifest.partition_spec_id = partition_spec_id[index];
 		manifest.sequence_number = 0;
 
@@ -106,6 +133,15 @@ idx_t ManifestListReader::ReadChunk(idx_t offset, idx_t count, vector<IcebergMan
 			manifest.existing_rows_count = 0;
 		}
 
+		if (added_files_count && existing_files_count &&
+		    FlatVector::Validity(*added_files_count).RowIsValid(index) &&
+		    FlatVector::Validity(*existing_files_count).RowIsValid(index)) {
+			manifest.has_file_counts = true;
+			manifest.added_files_count = NumericCast<idx_t>(FlatVector::GetData<int32_t>(*added_files_count)[index]);
+			manifest.existing_files_count =
+			    NumericCast<idx_t>(FlatVector::GetData<int32_t>(*existing_files_count)[index]);
+		}
+
 		if (field_summary) {
 			manifest.partitions.has_partitions = true;
 			auto &summaries = manifest.partitions.field_summary;
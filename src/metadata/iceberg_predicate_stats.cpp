@@ -0,0 +1,35 @@
+#include "metadata/iceberg_predicate_stats.hpp"
+#include "iceberg_value.hpp"
+
+#include "duckdb/common/exception.hpp"
+
+namespace duckdb {
+
+Value IcebergPredicateStats::DeserializeBound(const string_t &bound, const string &name, const LogicalType &type,
+                                              const char *bound_name) {
+	auto deserialized_bound = IcebergValue::DeserializeValue(bound, type);
+	if (deserialized_bound.HasError()) {
+		throw InvalidConfigurationException("Column %s %s deserialization failed: %s", name, bound_name,
+		                                    deserialized_bound.GetError());
+	}
+	return deserialized_bound.GetValue();
+}
+
+void IcebergPredicateStats::DeserializeBounds(const Value &lower_bound_p, const Value &upper_bound_p,
+                                              const string &name, const LogicalType &type) {
+	if (lower_bound_p.IsNull()) {
+		lower_bound = Value(type);
+	} else {
+		D_ASSERT(lower_bound_p.type().id() == LogicalTypeId::BLOB);
+		lower_bound = DeserializeBound(lower_bound_p.GetValueUnsafe<string_t>(), name, type, "lower bound");
+	}
+
+	if (upper_bound_p.IsNull()) {
+		upper_bound = Value(type);
+	} else {
+		D_ASSERT(upper_bound_p.type().id() == LogicalTypeId::BLOB);
+		upper_bound = DeserializeBound(upper_bound_p.GetValueUnsafe<string_t>(), name, type, "upper bound");
+	}
+}
+
+} // namespace duckdb
@@ -7,7 +7,7 @@ IcebergSnapshot IcebergSnapshot::ParseSnapshot(rest_api_objects::Snapshot &snaps
 	IcebergSnapshot ret;
 	if (metadata.iceberg_version == 1) {
 		ret.sequence_number = 0;
-	} else if (metadata.iceberg_version == 2) {
+	} else {
 		D_ASSERT(snapshot.has_sequence_number);
 		ret.sequence_number = snapshot.sequence_number;
 	}
@@ -2,6 +2,7 @@
 
 #include "iceberg_utils.hpp"
 #include "catalog_utils.hpp"
+#include "duckdb/main/client_context.hpp"
 #include "rest_catalog/objects/list.hpp"
 
 namespace duckdb {
@@ -231,6 +232,26 @@ rest_api_objects::TableMetadata IcebergTableMetadata::Parse(const string &path,
 	return rest_api_objects::TableMetadata::FromJSON(root);
 }
 
+shared_ptr<IcebergTableMetadata> IcebergTableMetadata::Load(ClientContext &context, const string &path, FileSystem &fs,
+                                                            const string &metadata_compression_codec) {
+	auto max_entries = IcebergTableMetadataCache::GetMaxEntries(context);
+	auto &cache = IcebergTableMetadataCache::Get(context);
+	//! The codec changes how the file is read, so it's part of the key
+	auto key = metadata_compression_codec + ":" + path;
+	if (max_entries) {
+		auto cached = cache.Get(key);
+		if (cached) {
+			return cached;
+		}
+	}
+	auto table_metadata = Parse(path, fs, metadata_compression_codec);
+	auto result = make_shared_ptr<IcebergTableMetadata>(FromTableMetadata(table_metadata));
+	if (max_entries) {
+		cache.Put(key, result, max_entries);
+	}
+	return result;
+}
+
 IcebergTableMetadata IcebergTableMetadata::FromTableMetadata(rest_api_objects::TableMetadata &table_metadata) {
 	IcebergTableMetadata res;
 
@@ -269,4 +290,51 @@ IcebergTableMetadata IcebergTableMetadata::FromTableMetadata(rest_api_objects::T
 	return res;
 }
 
+//! ----------- Metadata Cache -----------
+
+IcebergTableMetadataCache &IcebergTableMetadataCache::Get(ClientContext &context) {
+	auto &object_cache = ObjectCache::GetObjectCache(context);
+	return *object_cache.GetOrCreate<IcebergTableMetadataCache>(CACHE_KEY);
+}
+
+idx_t IcebergTableMetadataCache::GetMaxEntries(ClientContext &context) {
+	Value result;
+	(void)context.TryGetCurrentSetting(METADATA_CACHE_ENTRIES_CONFIG_VARIABLE, result);
+	if (result.IsNull()) {
+		return DEFAULT_METADATA_CACHE_ENTRIES;
+	}
+	return result.GetValue<uint64_t>();
+}
+
+shared_ptr<IcebergTableMetadata> IcebergTableMetadataCache::Get(const string &key) {
+	lock_guard<mutex> guard(lock);
+	auto it = entries.find(key);
+	if (it == entries.end()) {
+		return nullptr;
+	}
+	auto &entry = it->second;
+	//! Mark the entry as most recently used
+	lru.splice(lru.begin(), lru, entry.lru_position);
+	return entry.metadata;
+}
+
+void IcebergTableMetadataCache::Put(const string &key, shared_ptr<IcebergTableMetadata> metadata, idx_t max_entries) {
+	lock_guard<mutex> guard(lock);
+	auto it = entries.find(key);
+	if (it != entries.end()) {
+		//! Parsed by another query in the meantime, keep the entry that is already shared
+		lru.splice(lru.begin(), lru, it->second.lru_position);
+		return;
+	}
+	lru.push_front(key);
+	CacheEntry entry;
+	entry.metadata = std::move(metadata);
+	entry.lru_position = lru.begin();
+	entries.emplace(key, std::move(entry));
+	while (entries.size() > max_entries) {
+		entries.erase(lru.back());
+		lru.pop_back();
+	}
+}
+
 } // namespace duckdb
@@ -1,5 +1,12 @@
 #include "metadata/iceberg_transform.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/common/types/decimal.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/types/interval.hpp"
 
 namespace duckdb {
 
@@ -62,4 +69,336 @@ LogicalType IcebergTransform::GetSerializedType(const LogicalType &input) const
 	}
 }
 
+//! ----------- Bucket Hash -----------
+
+static uint32_t RotateLeft(uint32_t value, uint8_t count) {
+	return (value << count) | (value >> (32 - count));
+}
+
+//! MurmurHash3_x86_32 with seed 0, https://iceberg.apache.org/spec/#appendix-b-32-bit-hash-requirements
+static int32_t Murmur3Hash(const_data_ptr_t data, idx_t length) {
+	static constexpr uint32_t C1 = 0xcc9e2d51;
+	static constexpr uint32_t C2 = 0x1b873593;
+
+	uint32_t hash = 0;
+	idx_t block_count = length / 4;
+	for (idx_t i = 0; i < block_count; i++) {
+		auto block = data + i * 4;
+		uint32_t k = uint32_t(block[0]) | uint32_t(block[1]) << 8 | uint32_t(block[2]) << 16 | uint32_t(block[3]) << 24;
+		k *= C1;
+		k = RotateLeft(k, 15);
+		k *= C2;
+		hash ^= k;
+		hash = RotateLeft(hash, 13);
+		hash = hash * 5 + 0xe6546b64;
+	}
+
+	auto tail = data + block_count * 4;
+	uint32_t k = 0;
+	switch (length & 3) {
+	case 3:
+		k ^= uint32_t(tail[2]) << 16;
+		DUCKDB_EXPLICIT_FALLTHROUGH;
+	case 2:
+		k ^= uint32_t(tail[1]) << 8;
+		DUCKDB_EXPLICIT_FALLTHROUGH;
+	case 1:
+		k ^= uint32_t(tail[0]);
+		k *= C1;
+		k = RotateLeft(k, 15);
+		k *= C2;
+		hash ^= k;
+		break;
+	default:
+		break;
+	}
+
+	hash ^= NumericCast<uint32_t>(length);
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6b;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35;
+	hash ^= hash >> 16;
+	return static_cast<int32_t>(hash);
+}
+
+//! int, long, date, time and timestamps are hashed as the little-endian bytes of a long
+static int32_t HashLong(int64_t value) {
+	uint8_t bytes[sizeof(int64_t)];
+	for (idx_t i = 0; i < sizeof(int64_t); i++) {
+		bytes[i] = static_cast<uint8_t>(static_cast<uint64_t>(value) >> (i * 8));
+	}
+	return Murmur3Hash(bytes, sizeof(int64_t));
+}
+
+//! Decimals are hashed as the minimal big-endian two's complement bytes of the unscaled value
+static int32_t HashDecimal(hugeint_t unscaled) {
+	uint8_t bytes[sizeof(hugeint_t)];
+	auto upper = static_cast<uint64_t>(unscaled.upper);
+	auto lower = unscaled.lower;
+	for (idx_t i = 0; i < sizeof(uint64_t); i++) {
+		bytes[i] = static_cast<uint8_t>(upper >> ((7 - i) * 8));
+		bytes[i + 8] = static_cast<uint8_t>(lower >> ((7 - i) * 8));
+	}
+	//! Strip the leading bytes that only repeat the sign
+	idx_t start = 0;
+	while (start + 1 < sizeof(hugeint_t)) {
+		auto sign_extension = (bytes[start + 1] & 0x80) ? 0xFF : 0x00;
+		if (bytes[start] != sign_extension) {
+			break;
+		}
+		start++;
+	}
+	return Murmur3Hash(bytes + start, sizeof(hugeint_t) - start);
+}
+
+bool IcebergTransform::TryHashValue(const Value &value, int32_t &result) {
+	if (value.IsNull()) {
+		return false;
+	}
+	auto &type = value.type();
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		result = HashLong(value.GetValue<int64_t>());
+		return true;
+	case LogicalTypeId::DATE:
+		result = HashLong(value.GetValue<date_t>().days);
+		return true;
+	case LogicalTypeId::TIME:
+		result = HashLong(value.GetValue<dtime_t>().micros);
+		return true;
+	case LogicalTypeId::TIMESTAMP:
+		result = HashLong(value.GetValue<timestamp_t>().value);
+		return true;
+	case LogicalTypeId::TIMESTAMP_TZ:
+		result = HashLong(value.GetValue<timestamp_tz_t>().value);
+		return true;
+	case LogicalTypeId::DECIMAL: {
+		hugeint_t unscaled;
+		switch (type.InternalType()) {
+		case PhysicalType::INT16:
+			unscaled = hugeint_t(value.GetValueUnsafe<int16_t>());
+			break;
+		case PhysicalType::INT32:
+			unscaled = hugeint_t(value.GetValueUnsafe<int32_t>());
+			break;
+		case PhysicalType::INT64:
+			unscaled = hugeint_t(value.GetValueUnsafe<int64_t>());
+			break;
+		case PhysicalType::INT128:
+			unscaled = value.GetValueUnsafe<hugeint_t>();
+			break;
+		default:
+			return false;
+		}
+		result = HashDecimal(unscaled);
+		return true;
+	}
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		auto &str = StringValue::Get(value);
+		result = Murmur3Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	case LogicalTypeId::UUID: {
+		//! The 16 bytes of the UUID in big-endian order, DuckDB stores the UUID with the top bit flipped
+		auto uuid = value.GetValueUnsafe<hugeint_t>();
+		auto upper = static_cast<uint64_t>(uuid.upper) ^ (uint64_t(1) << 63);
+		uint8_t bytes[sizeof(hugeint_t)];
+		for (idx_t i = 0; i < sizeof(uint64_t); i++) {
+			bytes[i] = static_cast<uint8_t>(upper >> ((7 - i) * 8));
+			bytes[i + 8] = static_cast<uint8_t>(uuid.lower >> ((7 - i) * 8));
+		}
+		result = Murmur3Hash(bytes, sizeof(hugeint_t));
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! ----------- Truncate -----------
+
+//! v - (((v % W) + W) % W), rounds towards negative infinity
+static hugeint_t TruncateInteger(hugeint_t value, hugeint_t width) {
+	return value - (((value % width) + width) % width);
+}
+
+Value IcebergTransform::TruncateValue(const Value &value, idx_t width) {
+	auto &type = value.type();
+	if (value.IsNull() || width == 0) {
+		return Value(type);
+	}
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT: {
+		auto truncated = TruncateInteger(hugeint_t(value.GetValue<int64_t>()), hugeint_t(width));
+		Value result;
+		string error;
+		if (!Value::HUGEINT(truncated).DefaultTryCastAs(type, result, &error)) {
+			//! Truncated below the minimum of the type, can't be used to compare
+			return Value(type);
+		}
+		return result;
+	}
+	case LogicalTypeId::DECIMAL: {
+		auto decimal_width = DecimalType::GetWidth(type);
+		auto decimal_scale = DecimalType::GetScale(type);
+		hugeint_t unscaled;
+		switch (type.InternalType()) {
+		case PhysicalType::INT16:
+			unscaled = hugeint_t(value.GetValueUnsafe<int16_t>());
+			break;
+		case PhysicalType::INT32:
+			unscaled = hugeint_t(value.GetValueUnsafe<int32_t>());
+			break;
+		case PhysicalType::INT64:
+			unscaled = hugeint_t(value.GetValueUnsafe<int64_t>());
+			break;
+		case PhysicalType::INT128:
+			unscaled = value.GetValueUnsafe<hugeint_t>();
+			break;
+		default:
+			return Value(type);
+		}
+		auto truncated = TruncateInteger(unscaled, hugeint_t(width));
+		if (truncated <= -Hugeint::POWERS_OF_TEN[decimal_width]) {
+			return Value(type);
+		}
+		if (type.InternalType() == PhysicalType::INT128) {
+			return Value::DECIMAL(truncated, decimal_width, decimal_scale);
+		}
+		return Value::DECIMAL(Hugeint::Cast<int64_t>(truncated), decimal_width, decimal_scale);
+	}
+	case LogicalTypeId::VARCHAR: {
+		//! Cut at the start of the code point that would exceed the width
+		auto &str = StringValue::Get(value);
+		idx_t code_points = 0;
+		idx_t length = 0;
+		for (; length < str.size(); length++) {
+			auto byte = static_cast<uint8_t>(str[length]);
+			if ((byte & 0xC0) == 0x80) {
+				//! Continuation byte
+				continue;
+			}
+			if (code_points == width) {
+				break;
+			}
+			code_points++;
+		}
+		return Value(str.substr(0, length));
+	}
+	case LogicalTypeId::BLOB: {
+		auto &str = StringValue::Get(value);
+		return Value::BLOB(const_data_ptr_cast(str.c_str()), MinValue<idx_t>(str.size(), width));
+	}
+	default:
+		throw NotImplementedException("'truncate' transform for type %s", type.ToString());
+	}
+}
+
+bool IcebergTransform::BoundsContainPrefix(const Value &prefix, const IcebergPredicateStats &stats) {
+	if (prefix.type().id() != LogicalTypeId::VARCHAR || stats.lower_bound.type().id() != LogicalTypeId::VARCHAR ||
+	    stats.upper_bound.type().id() != LogicalTypeId::VARCHAR) {
+		return true;
+	}
+	auto &prefix_str = StringValue::Get(prefix);
+	auto &lower = StringValue::Get(stats.lower_bound);
+	auto &upper = StringValue::Get(stats.upper_bound);
+	//! Every string that starts with the prefix sorts at or after the prefix itself
+	if (upper < prefix_str) {
+		return false;
+	}
+	//! ... and before the first string that is larger than the prefix without starting with it
+	if (lower > prefix_str && !StringUtil::StartsWith(lower, prefix_str)) {
+		return false;
+	}
+	return true;
+}
+
+//! ----------- Year / Month / Day / Hour -----------
+
+//! Division that rounds towards negative infinity, values before the epoch belong to earlier partitions
+static int64_t FloorDivide(int64_t value, int64_t divisor, bool &exact) {
+	auto result = value / divisor;
+	auto remainder = value % divisor;
+	exact = remainder == 0;
+	if (remainder != 0 && ((remainder < 0) != (divisor < 0))) {
+		result--;
+	}
+	return result;
+}
+
+static Value TemporalResult(int64_t result) {
+	int32_t value;
+	if (!TryCast::Operation(result, value)) {
+		//! Outside of the range of the partition values, can't be compared
+		return Value(LogicalType::INTEGER);
+	}
+	return Value::INTEGER(value);
+}
+
+static Value TransformDate(date_t date, IcebergTransformType type, bool time_is_zero, bool &partition_start) {
+	int32_t year;
+	int32_t month;
+	int32_t day;
+	Date::Convert(date, year, month, day);
+	switch (type) {
+	case IcebergTransformType::YEAR:
+		partition_start = time_is_zero && month == 1 && day == 1;
+		return TemporalResult(int64_t(year) - 1970);
+	case IcebergTransformType::MONTH:
+		partition_start = time_is_zero && day == 1;
+		return TemporalResult((int64_t(year) - 1970) * Interval::MONTHS_PER_YEAR + month - 1);
+	case IcebergTransformType::DAY:
+		partition_start = time_is_zero;
+		return TemporalResult(date.days);
+	default:
+		throw InternalException("TransformDate called with a non-temporal transform");
+	}
+}
+
+Value IcebergTransform::ApplyTemporalTransform(const Value &value, IcebergTransformType type, bool &partition_start) {
+	partition_start = false;
+	if (value.IsNull()) {
+		return Value(LogicalType::INTEGER);
+	}
+	switch (value.type().id()) {
+	case LogicalTypeId::DATE: {
+		auto date = value.GetValue<date_t>();
+		if (!Date::IsFinite(date)) {
+			return Value(LogicalType::INTEGER);
+		}
+		if (type == IcebergTransformType::HOUR) {
+			throw NotImplementedException("'hour' transform for type %s", value.type().ToString());
+		}
+		return TransformDate(date, type, true, partition_start);
+	}
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_TZ: {
+		//! timestamptz is stored as UTC, which is what the partition values are derived from as well
+		auto timestamp = timestamp_t(value.GetValueUnsafe<int64_t>());
+		if (!Timestamp::IsFinite(timestamp)) {
+			return Value(LogicalType::INTEGER);
+		}
+		if (type == IcebergTransformType::HOUR) {
+			auto hours = FloorDivide(Timestamp::GetEpochMicroSeconds(timestamp), Interval::MICROS_PER_HOUR,
+			                         partition_start);
+			return TemporalResult(hours);
+		}
+		bool time_is_zero;
+		auto days =
+		    FloorDivide(Timestamp::GetEpochMicroSeconds(timestamp), Interval::MICROS_PER_DAY, time_is_zero);
+		return TransformDate(date_t(NumericCast<int32_t>(days)), type, time_is_zero, partition_start);
+	}
+	default:
+		throw NotImplementedException("Temporal transform for type %s", value.type().ToString());
+	}
+}
+
 } // namespace duckdb
@@ -1,6 +1,8 @@
 #include "storage/irc_catalog.hpp"
 #include "storage/irc_schema_entry.hpp"
 #include "storage/irc_table_entry.hpp"
+#include "iceberg_multi_file_list.hpp"
+#include "iceberg_table_statistics.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/main/extension_util.hpp"
@@ -27,7 +29,27 @@ ICTableEntry::ICTableEntry(IcebergTableInformation &table_info, Catalog &catalog
 }
 
 unique_ptr<BaseStatistics> ICTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
-	return nullptr;
+	if (!IcebergTableStatistics::IsEnabled(context)) {
+		return nullptr;
+	}
+	//! The statistics of the latest snapshot, read with the current schema (like a scan without an AT clause)
+	auto &metadata = table_info.table_metadata;
+	auto snapshot = metadata.GetSnapshot(IcebergSnapshotLookup());
+	if (!snapshot) {
+		return nullptr;
+	}
+	auto schema = metadata.GetSchemaFromId(metadata.current_schema_id);
+	auto statistics = IcebergTableStatistics::TryGet(context, *snapshot, *schema);
+	if (!statistics) {
+		//! Reading the manifests requires the credentials of the table
+		auto storage_location = PrepareIcebergScanFromEntry(context);
+		auto &metadata_location = table_info.load_table_result.metadata_location;
+		auto scan_info = make_shared_ptr<IcebergScanInfo>(metadata_location, metadata, snapshot, *schema);
+		IcebergOptions options;
+		IcebergMultiFileList multi_file_list(context, scan_info, storage_location, options);
+		statistics = IcebergTableStatistics::Get(context, multi_file_list);
+	}
+	return statistics->GetColumnStatistics(column_id);
 }
 
 void ICTableEntry::BindUpdateConstraints(Binder &binder, LogicalGet &, LogicalProjection &, LogicalUpdate &,